@@ -0,0 +1,104 @@
+// Lookup benchmark: SvMap vs std::unordered_map<std::string, void *>.
+// Not built by CI. Build and run from the repository root with e.g.
+//   g++ -std=c++17 -O2 -o sv_map_bench bench/sv_map_bench.cpp && ./sv_map_bench
+//
+// Keys are metric-style names ("svc.<service>.<host>.<metric>"), 12-40 bytes.
+// Both tables hold the same keys and see the same shuffled queries, half hits
+// and half misses. std::unordered_map is queried with prebuilt std::string
+// keys, so neither side pays for constructing a key per lookup.
+
+#define SV_IMPLEMENTATION
+#include "../sv.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+static const size_t KEYS    = 100000;
+static const size_t QUERIES = 2000000;
+static const int    ROUNDS  = 5;
+
+static std::string
+metric_name(std::mt19937_64 &rng)
+{
+    static const char *const metrics[] = { "latency_p99", "requests", "errors", "bytes_in", "cpu", "rss" };
+    char buf[64];
+    std::snprintf(buf, sizeof buf, "svc.%04u.host%03u.%s",
+                  (unsigned)(rng() % 10000), (unsigned)(rng() % 1000), metrics[rng() % 6]);
+    return buf;
+}
+
+template <typename F>
+static double
+best_ns_per_lookup(F lookup)
+{
+    double best = 1e30;
+    for (int round = 0; round < ROUNDS; ++round) {
+        const auto start = std::chrono::steady_clock::now();
+        lookup();
+        const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count() / QUERIES);
+    }
+    return best;
+}
+
+int
+main()
+{
+    std::mt19937_64 rng(42);
+
+    std::vector<std::string> keys;
+    std::unordered_map<std::string, void *> index;
+    while (keys.size() < KEYS) {
+        std::string key = metric_name(rng);
+        if (index.emplace(key, (void *)(uintptr_t)(keys.size() + 1)).second) keys.push_back(key);
+    }
+
+    SvMap map;
+    if (!sv_map_init(&map, KEYS, rng(), NULL)) return 1;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        if (!sv_map_insert(&map, sv_from_parts(keys[i].data(), keys[i].size()), (void *)(uintptr_t)(i + 1))) return 1;
+    }
+
+    // Misses are names from the same distribution that were not inserted
+    std::vector<std::string> queries;
+    queries.reserve(QUERIES);
+    while (queries.size() < QUERIES) {
+        if (queries.size() % 2 == 0) {
+            queries.push_back(keys[rng() % keys.size()]);
+        } else {
+            std::string miss = metric_name(rng);
+            if (index.find(miss) == index.end()) queries.push_back(miss);
+        }
+    }
+    std::shuffle(queries.begin(), queries.end(), rng);
+
+    std::vector<StringView> views;
+    for (const std::string &q : queries) views.push_back(sv_from_parts(q.data(), q.size()));
+
+    uintptr_t sink = 0;
+    const double sv_ns = best_ns_per_lookup([&] {
+        for (const StringView &q : views) {
+            void **value = sv_map_find(&map, q);
+            sink += value ? (uintptr_t)*value : 1;
+        }
+    });
+    const double std_ns = best_ns_per_lookup([&] {
+        for (const std::string &q : queries) {
+            auto it = index.find(q);
+            sink += it != index.end() ? (uintptr_t)it->second : 1;
+        }
+    });
+
+    std::printf("%zu keys, %zu lookups (50%% hits), best of %d\n", KEYS, QUERIES, ROUNDS);
+    std::printf("  sv_map_find                 %6.1f ns/lookup\n", sv_ns);
+    std::printf("  std::unordered_map::find    %6.1f ns/lookup\n", std_ns);
+    std::printf("  (checksum %zu)\n", (size_t)(sink & 0xFF));
+
+    sv_map_free(&map);
+    return 0;
+}
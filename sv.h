@@ -12,15 +12,23 @@
  *  - StringView is a non-owning view of memory. It never allocates or frees.
  *  - The caller is responsible for ensuring the underlying memory remains valid
  *    for the lifetime of the view.
+ *  - Lookup structures built from views (SvMultiSearcher, ...) allocate only when
+ *    built, through an optional SvAllocator, and must be released with their _free().
  *  - Bounds & OOR policy:
  *      * Strict (no checks): sv_at/sv_first/sv_last/sv_substr/sv_take/sv_drop, caller must keep indices/counts in range. OOR is undefined behavior (asserts in debug builds).
  *      * Safe (validated/clamped): find/rfind/_from/split/contains/parse are never UB due to positions. They return SV_NPOS/false on failure and may clamp pos as documented.
  *  - All parsing functions are strict:
- *      * Decimal only (no hex, octal, etc.)
+ *      * Decimal only, except sv_to_*_base() (bases 2-36) and sv_hex_decode()
  *      * No leading/trailing whitespace
  *      * No locale-dependent formats
  *      * Overflow or invalid input -> return false
- *  - Trimming uses isspace(), which is locale-dependent.
+ *  - sv_trim*() uses isspace(), which is locale-dependent. Define SV_TRIM_ASCII
+ *    to make it use the locale-free sv_trim*_ascii() instead.
+ *  - sv_hash() is FNV-1a. Define SV_HASH_WYHASH to make it the faster, better
+ *    mixing sv_hash64_seeded(sv, 0) instead (this changes every hash value).
+ *  - Search kernels use SSE2/AVX2/AVX-512 (SSE4.2 and PCLMUL for sv_crc32c) when
+ *    the compiler targets them, with scalar fallbacks elsewhere. Define
+ *    SV_NO_SIMD to disable them.
  *
  *  LICENSE:
  *   `sp.h` is licensed under the 3-Clause BSD license. Full license text is
@@ -61,6 +69,46 @@
 #define SV_NPOS SIZE_MAX
 #endif
 
+// SIMD code paths are selected at compile time from the target flags
+// (-msse2, -mavx2, -mavx512bw, /arch:AVX2, ...). There is no runtime dispatch,
+// so build with the widest instruction set your deployment targets support.
+// Define SV_NO_SIMD before including sv.h to force the portable scalar paths.
+#if !defined(SV_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define SV_HAS_SSE2 1
+#else
+#define SV_HAS_SSE2 0
+#endif
+
+#if SV_HAS_SSE2 && defined(__AVX2__)
+#define SV_HAS_AVX2 1
+#else
+#define SV_HAS_AVX2 0
+#endif
+
+#if SV_HAS_SSE2 && (defined(__SSSE3__) || defined(__AVX__))
+#define SV_HAS_SSSE3 1
+#else
+#define SV_HAS_SSSE3 0
+#endif
+
+#if SV_HAS_AVX2 && defined(__AVX512BW__)
+#define SV_HAS_AVX512 1
+#else
+#define SV_HAS_AVX512 0
+#endif
+
+#if SV_HAS_SSE2 && (defined(__SSE4_2__) || defined(__AVX__))
+#define SV_HAS_SSE42 1
+#else
+#define SV_HAS_SSE42 0
+#endif
+
+#if SV_HAS_SSE42 && (defined(__PCLMUL__) || (defined(_MSC_VER) && defined(__AVX__)))
+#define SV_HAS_PCLMUL 1
+#else
+#define SV_HAS_PCLMUL 0
+#endif
+
 #ifndef __cplusplus
 #define SV_NO_PARAMS void
 #else
@@ -78,6 +126,11 @@
 #include <string_view>
 #endif
 
+// C++14 relaxed constexpr enables the compile-time helpers (sv_*_ct, sv_switch)
+#if defined(__cplusplus) && __cplusplus >= 201402L && !defined(SV_NO_CONSTEXPR)
+#define SV_CONSTEXPR_CPP
+#endif
+
 #ifdef __cplusplus
 #define SV_NOEXCEPT noexcept
 #if defined(__cpp_noexcept_function_type) || __cplusplus >= 201103L
@@ -169,6 +222,17 @@ SV_NODISCARD SVDEF size_t sv_find_char_from(StringView sv, size_t pos, char c) S
 // Find c at or before pos. pos is clamped to [0, length-1] if non-empty, returns SV_NPOS if empty or not found
 SV_NODISCARD SVDEF size_t sv_rfind_char_from(StringView sv, size_t pos, char c) SV_NOEXCEPT;
 
+// Find first/last occurrence of any of two or three bytes in one pass.
+// Same return values and pos clamping as sv_find_char/sv_rfind_char and their _from variants.
+SV_NODISCARD SVDEF size_t sv_find_char2(StringView sv, char c1, char c2) SV_NOEXCEPT;
+SV_NODISCARD SVDEF size_t sv_find_char3(StringView sv, char c1, char c2, char c3) SV_NOEXCEPT;
+SV_NODISCARD SVDEF size_t sv_rfind_char2(StringView sv, char c1, char c2) SV_NOEXCEPT;
+SV_NODISCARD SVDEF size_t sv_rfind_char3(StringView sv, char c1, char c2, char c3) SV_NOEXCEPT;
+SV_NODISCARD SVDEF size_t sv_find_char2_from(StringView sv, size_t pos, char c1, char c2) SV_NOEXCEPT;
+SV_NODISCARD SVDEF size_t sv_find_char3_from(StringView sv, size_t pos, char c1, char c2, char c3) SV_NOEXCEPT;
+SV_NODISCARD SVDEF size_t sv_rfind_char2_from(StringView sv, size_t pos, char c1, char c2) SV_NOEXCEPT;
+SV_NODISCARD SVDEF size_t sv_rfind_char3_from(StringView sv, size_t pos, char c1, char c2, char c3) SV_NOEXCEPT;
+
 // Find first occurence of needle. Returns SV_NPOS if not found.
 SV_NODISCARD SVDEF size_t sv_find_substr(StringView hay, StringView needle) SV_NOEXCEPT;
 
@@ -194,18 +258,179 @@ SV_NODISCARD SVDEF bool sv_contains(StringView hay, StringView needle) SV_NOEXCE
 SV_NODISCARD SVDEF bool sv_contains_cstr(StringView hay, const char *needle) SV_NOEXCEPT;
 
 
+//
+// Precompiled searching
+//
+
+// A needle preprocessed once for repeated searches over many haystacks.
+// The strategy is picked from the needle length: memchr() for single bytes,
+// the SIMD first/last byte filter for short needles, and Two-Way
+// (Crochemore-Perrin) for long needles, which gives linear worst-case time.
+// The searcher keeps a view of the needle, so the needle memory must outlive it.
+// Fields are internal, initialize with sv_searcher_init().
+typedef enum {
+    SV_SEARCHER_EMPTY,
+    SV_SEARCHER_BYTE,
+    SV_SEARCHER_SHORT,
+    SV_SEARCHER_TWO_WAY
+} SvSearcherKind;
+
+typedef struct {
+    StringView     needle;
+    SvSearcherKind kind;
+    // Two-Way factorization of the needle read forwards and backwards
+    size_t         fwd_suffix, fwd_period;
+    size_t         rev_suffix, rev_period;
+    bool           fwd_periodic, rev_periodic;
+} SvSearcher;
+
+// Needles up to this length use the SIMD filter, longer ones use Two-Way
+#ifndef SV_SEARCHER_SHORT_MAX
+#define SV_SEARCHER_SHORT_MAX 32
+#endif
+
+SVDEF void sv_searcher_init(SvSearcher *searcher, StringView needle) SV_NOEXCEPT;
+
+// Same results and pos clamping as sv_find_substr/sv_find_substr_from/sv_rfind_substr/sv_rfind_substr_from
+SV_NODISCARD SVDEF size_t sv_searcher_find(const SvSearcher *searcher, StringView hay) SV_NOEXCEPT;
+SV_NODISCARD SVDEF size_t sv_searcher_find_from(const SvSearcher *searcher, StringView hay, size_t pos) SV_NOEXCEPT;
+SV_NODISCARD SVDEF size_t sv_searcher_rfind(const SvSearcher *searcher, StringView hay) SV_NOEXCEPT;
+SV_NODISCARD SVDEF size_t sv_searcher_rfind_from(const SvSearcher *searcher, StringView hay, size_t pos) SV_NOEXCEPT;
+
+
+//
+// Allocation
+//
+
+// Builders of lookup structures allocate through an SvAllocator. Passing NULL
+// uses SV_MALLOC/SV_FREE, which default to malloc()/free() and can be defined
+// before including the implementation. free() receives the size that was allocated.
+typedef struct {
+    void *(*alloc)(void *ctx, size_t size);
+    void  (*free)(void *ctx, void *ptr, size_t size);
+    void   *ctx;
+} SvAllocator;
+
+
+//
+// Multi-pattern searching
+//
+
+// A set of literal patterns searched in one pass. Small sets use a Teddy
+// (SIMD nibble-mask fingerprint) prefilter, large sets, or builds without
+// SSSE3, use an Aho-Corasick automaton. Matching never allocates.
+// Like SvSearcher, pattern bytes must outlive the searcher. The pattern
+// array itself is copied. Fields are internal.
+typedef enum {
+    SV_MULTI_SEARCHER_AHO_CORASICK,
+    SV_MULTI_SEARCHER_TEDDY
+} SvMultiSearcherKind;
+
+typedef struct {
+    SvMultiSearcherKind kind;
+    const StringView   *patterns;
+    size_t              count;
+    size_t              max_length;
+    size_t              empty_index;       // lowest index of an empty pattern, or SV_NPOS
+
+    // Teddy: per fingerprint byte, bucket bits by low and high nibble
+    unsigned char       teddy_lo[3][16];
+    unsigned char       teddy_hi[3][16];
+    size_t              teddy_width;
+    const uint32_t     *teddy_bucket_start; // 9 entries into teddy_bucket_patterns
+    const uint32_t     *teddy_bucket_patterns;
+
+    // Aho-Corasick: DFA over byte classes, out[state] = longest pattern index + 1
+    unsigned char       byte_class[256];
+    size_t              class_count;
+    const uint32_t     *ac_next;
+    const uint32_t     *ac_out;
+
+    void               *memory;
+    size_t              memory_size;
+    SvAllocator         allocator;
+} SvMultiSearcher;
+
+// Sets with at most this many patterns use Teddy when SSSE3 is available
+#ifndef SV_MULTI_TEDDY_MAX
+#define SV_MULTI_TEDDY_MAX 32
+#endif
+
+// Build a searcher for patterns[0..count). allocator may be NULL.
+// Returns false if allocation fails or the patterns are too large to index.
+SV_NODISCARD SVDEF bool sv_multi_searcher_init(SvMultiSearcher   *searcher,
+                                               const StringView  *patterns,
+                                               size_t             count,
+                                               const SvAllocator *allocator) SV_NOEXCEPT;
+SVDEF void sv_multi_searcher_free(SvMultiSearcher *searcher) SV_NOEXCEPT;
+
+// Leftmost match of any pattern. Among patterns matching at the same position
+// the lowest index wins. Returns the match position and stores the pattern index
+// in *out_pattern (may be NULL), or returns SV_NPOS. pos is clamped to [0, length].
+SV_NODISCARD SVDEF size_t sv_multi_searcher_find(const SvMultiSearcher *searcher,
+                                                 StringView             hay,
+                                                 size_t                *out_pattern) SV_NOEXCEPT;
+SV_NODISCARD SVDEF size_t sv_multi_searcher_find_from(const SvMultiSearcher *searcher,
+                                                      StringView             hay,
+                                                      size_t                 pos,
+                                                      size_t                *out_pattern) SV_NOEXCEPT;
+
+
+//
+// Byte sets
+//
+
+// Set of byte values, precompiled for vectorized classification. Alongside the
+// 256-bit membership bitmap it keeps nibble lookup tables, so SSSE3/AVX2/AVX-512
+// builds test 16/32/64 bytes per step with pshufb. Fields are internal.
+typedef struct {
+    uint64_t      bits[4];
+    unsigned char nibble[2][16];  // [high nibble >= 8][low nibble] -> bit (high nibble & 7)
+} SvByteSet;
+
+// Initialize to the bytes in chars, e.g. sv_byteset_init(&set, SV_LIT(" \t\r\n"))
+SVDEF void sv_byteset_init(SvByteSet *set, StringView chars) SV_NOEXCEPT;
+SVDEF void sv_byteset_add(SvByteSet *set, char c) SV_NOEXCEPT;
+SV_NODISCARD SVDEF bool sv_byteset_contains(const SvByteSet *set, char c) SV_NOEXCEPT;
+
+// First/last byte in (or not in) set. Returns SV_NPOS if there is none.
+SV_NODISCARD SVDEF size_t sv_find_first_of(StringView sv, const SvByteSet *set) SV_NOEXCEPT;
+SV_NODISCARD SVDEF size_t sv_find_first_not_of(StringView sv, const SvByteSet *set) SV_NOEXCEPT;
+SV_NODISCARD SVDEF size_t sv_find_last_of(StringView sv, const SvByteSet *set) SV_NOEXCEPT;
+SV_NODISCARD SVDEF size_t sv_find_last_not_of(StringView sv, const SvByteSet *set) SV_NOEXCEPT;
+
+// At or after pos. Returns SV_NPOS if pos >= length (like sv_find_char_from)
+SV_NODISCARD SVDEF size_t sv_find_first_of_from(StringView sv, size_t pos, const SvByteSet *set) SV_NOEXCEPT;
+SV_NODISCARD SVDEF size_t sv_find_first_not_of_from(StringView sv, size_t pos, const SvByteSet *set) SV_NOEXCEPT;
+
+// At or before pos, pos clamped to [0, length-1] (like sv_rfind_char_from)
+SV_NODISCARD SVDEF size_t sv_find_last_of_from(StringView sv, size_t pos, const SvByteSet *set) SV_NOEXCEPT;
+SV_NODISCARD SVDEF size_t sv_find_last_not_of_from(StringView sv, size_t pos, const SvByteSet *set) SV_NOEXCEPT;
+
+
 
 //
 // Trimming, splitting
 //
 
-// Trim leading isspace() chars (locale-dependent)
+// Trim leading isspace() chars (locale-dependent, ASCII if SV_TRIM_ASCII is defined)
 SV_NODISCARD SVDEF StringView sv_trim_left(StringView sv) SV_NOEXCEPT;
-// Trim trailing isspace() chars (locale-dependent)
+// Trim trailing isspace() chars (locale-dependent, ASCII if SV_TRIM_ASCII is defined)
 SV_NODISCARD SVDEF StringView sv_trim_right(StringView sv) SV_NOEXCEPT;
 // Trim both ends
 SV_NODISCARD SVDEF StringView sv_trim(StringView sv) SV_NOEXCEPT;
 
+// Locale-free trims of ASCII whitespace (' ', '\t', '\n', '\v', '\f', '\r'),
+// classifying 16-32 bytes per step from either end
+SV_NODISCARD SVDEF StringView sv_trim_left_ascii(StringView sv) SV_NOEXCEPT;
+SV_NODISCARD SVDEF StringView sv_trim_right_ascii(StringView sv) SV_NOEXCEPT;
+SV_NODISCARD SVDEF StringView sv_trim_ascii(StringView sv) SV_NOEXCEPT;
+
+// Trim bytes that are in set
+SV_NODISCARD SVDEF StringView sv_trim_left_set(StringView sv, const SvByteSet *set) SV_NOEXCEPT;
+SV_NODISCARD SVDEF StringView sv_trim_right_set(StringView sv, const SvByteSet *set) SV_NOEXCEPT;
+SV_NODISCARD SVDEF StringView sv_trim_set(StringView sv, const SvByteSet *set) SV_NOEXCEPT;
+
 // Return first n chars. No bounds checks. If n > sv.length, behavior is undefined.
 SV_NODISCARD SVDEF StringView sv_take(StringView sv, size_t n) SV_NOEXCEPT;
 
@@ -249,6 +474,156 @@ SVDEF void sv_split_once_from(StringView  sv,
                               StringView *out_before_delim,
                               StringView *out_after_delim) SV_NOEXCEPT;
 
+// Split on the first byte that is in delims. If not found, before=sv, after=empty
+SVDEF void sv_split_first_of(StringView       sv,
+                             const SvByteSet *delims,
+                             StringView      *out_before_delim,
+                             StringView      *out_after_delim) SV_NOEXCEPT;
+
+// Iterator over the fields of sv separated by a byte, a multi-byte string or
+// any byte of a set. The delimiter is preprocessed once at init (multi-byte
+// delimiters use an SvSearcher), fields are views into sv and nothing is copied.
+// "a,,b" yields "a", "", "b" and an empty sv yields one empty field.
+//
+//   SvSplitIter it;
+//   StringView  field;
+//   sv_split_iter_init_str(&it, request, SV_LIT("\r\n"));
+//   while (sv_split_next(&it, &field)) { ... }
+typedef enum {
+    SV_SPLIT_CHAR,
+    SV_SPLIT_STR,
+    SV_SPLIT_SET
+} SvSplitKind;
+
+typedef struct {
+    // Options. Set after init, before the first sv_split_next()
+    bool        skip_empty;  // Do not yield empty fields
+    size_t      max_fields;  // 0 = unlimited, otherwise the last field is the unsplit remainder
+
+    // Internal state
+    StringView  rest;
+    size_t      count;
+    bool        done;
+    SvSplitKind kind;
+    char        delim_char;
+    SvSearcher  delim_str;
+    SvByteSet   delim_set;
+} SvSplitIter;
+
+SVDEF void sv_split_iter_init_char(SvSplitIter *it, StringView sv, char delim) SV_NOEXCEPT;
+// An empty delim never matches, so the whole of sv is one field. delim memory must outlive the iterator.
+SVDEF void sv_split_iter_init_str(SvSplitIter *it, StringView sv, StringView delim) SV_NOEXCEPT;
+SVDEF void sv_split_iter_init_set(SvSplitIter *it, StringView sv, const SvByteSet *delims) SV_NOEXCEPT;
+
+// Store the next field in *out_field and return true, or return false when exhausted
+SV_NODISCARD SVDEF bool sv_split_next(SvSplitIter *it, StringView *out_field) SV_NOEXCEPT;
+
+// Split sv on delim into out[0..cap) in one pass and return the number of fields
+// written. Fields follow SvSplitIter rules ("a,,b" gives "a", "", "b").
+// If sv holds more fields than cap, *out_next is set to the offset of the first
+// field not written (continue with sv_drop(sv, *out_next)), otherwise to SV_NPOS.
+// out_next may be NULL.
+SV_NODISCARD SVDEF size_t sv_split_into(StringView  sv,
+                                        char        delim,
+                                        StringView *out,
+                                        size_t      cap,
+                                        size_t     *out_next) SV_NOEXCEPT;
+
+// Iterator over the lines of sv. Lines end at '\n' or "\r\n"; the terminator is
+// stripped unless keep_terminators is set. A missing final newline is fine and
+// a trailing one does not add an empty line, so "a\nb" and "a\nb\n" both give
+// "a", "b". A lone '\r' is not a terminator. Lines are views into sv.
+//
+//   SvLineIter it;
+//   StringView line;
+//   sv_line_iter_init(&it, file_contents);
+//   while (sv_line_next(&it, &line)) { ... }
+typedef struct {
+    // Options. Set after init, before the first sv_line_next()
+    bool       keep_terminators;  // Include the "\n" or "\r\n" in each line
+
+    // Internal state
+    StringView rest;
+    size_t     count;  // Lines yielded so far
+} SvLineIter;
+
+SVDEF void sv_line_iter_init(SvLineIter *it, StringView sv) SV_NOEXCEPT;
+
+// Store the next line in *out_line and return true, or return false when exhausted
+SV_NODISCARD SVDEF bool sv_line_next(SvLineIter *it, StringView *out_line) SV_NOEXCEPT;
+
+// Store up to cap lines in out and return how many were stored; 0 when exhausted.
+// Newlines are located a 64-byte block at a time, which is much faster than
+// calling sv_line_next() when lines are short. Can be mixed with sv_line_next().
+SV_NODISCARD SVDEF size_t sv_line_next_batch(SvLineIter *it, StringView *out, size_t cap) SV_NOEXCEPT;
+
+
+//
+// CSV
+//
+
+// Zero-copy RFC 4180 reader. Fields are views into the input: quoted fields
+// are returned without their surrounding quotes, and a field that contains
+// doubled quotes ("") is flagged so the caller can unescape it lazily with
+// sv_csv_unescape(). Records end at options.newline; with options.crlf a '\r'
+// right before it is dropped, so "\n" and "\r\n" files both read correctly.
+// A missing final newline is fine, a trailing one does not add an empty record.
+//
+//   SvCsvReader r;
+//   SvCsvField  field;
+//   sv_csv_init(&r, input, NULL);
+//   while (sv_csv_next_field(&r, &field)) { ...; if (field.last_in_record) ... }
+//   if (sv_csv_error(&r)) { ... }
+typedef struct {
+    char delimiter;  // ',' by default, '\t' for TSV
+    char quote;      // '"' by default
+    char newline;    // Record terminator, '\n' by default
+    bool crlf;       // Drop a '\r' before newline, true by default
+} SvCsvOptions;
+
+typedef struct {
+    StringView value;           // Field contents without surrounding quotes
+    bool       quoted;          // Field was quoted
+    bool       needs_unescape;  // value contains doubled quotes
+    bool       last_in_record;  // Field ends its record
+} SvCsvField;
+
+typedef struct {
+    // Internal state
+    SvCsvOptions options;
+    StringView   input;
+    StringView   rest;
+    size_t       error_offset;
+    bool         field_pending;
+    bool         error;
+} SvCsvReader;
+
+// Default options: comma separated, '"' quoted, "\n" or "\r\n" records
+SV_NODISCARD SVDEF SvCsvOptions sv_csv_default_options(SV_NO_PARAMS) SV_NOEXCEPT;
+
+// options may be NULL for the defaults
+SVDEF void sv_csv_init(SvCsvReader *r, StringView input, const SvCsvOptions *options) SV_NOEXCEPT;
+
+// Store the next field in *out_field and return true, or return false at the end
+// of input or on malformed input (unterminated quote, data after a closing quote)
+SV_NODISCARD SVDEF bool sv_csv_next_field(SvCsvReader *r, SvCsvField *out_field) SV_NOEXCEPT;
+
+// Read one record into fields[0..cap) and return its number of fields, which
+// is larger than cap if the record was truncated. Returns 0 at the end of input
+// or on error. An empty line is a record with one empty field.
+SV_NODISCARD SVDEF size_t sv_csv_next_record(SvCsvReader *r, SvCsvField *fields, size_t cap) SV_NOEXCEPT;
+
+// True if reading stopped on malformed input. out_offset (may be NULL) receives
+// the offset into the input where the offending field starts.
+SV_NODISCARD SVDEF bool sv_csv_error(const SvCsvReader *r, size_t *out_offset) SV_NOEXCEPT;
+
+// Collapse doubled quotes of value into buffer and return a view of the result.
+// The result is never longer than value, truncated if buffer_size is smaller.
+SV_NODISCARD SVDEF StringView sv_csv_unescape(StringView  value,
+                                              char        quote,
+                                              char       *buffer,
+                                              size_t      buffer_size) SV_NOEXCEPT;
+
 
 //
 // Conversion
@@ -266,24 +641,159 @@ SV_NODISCARD SVDEF bool sv_to_uint64(StringView sv, uint64_t *out) SV_NOEXCEPT;
 SV_NODISCARD SVDEF bool sv_to_int64(StringView sv, int64_t *out) SV_NOEXCEPT;
 SV_NODISCARD SVDEF bool sv_to_long(StringView sv, long *out) SV_NOEXCEPT;
 
+// Strict parse in base 2-36 with the same sign, whitespace and overflow rules.
+// Digits past 9 are a-z or A-Z. Base 0 detects a "0x", "0o" or "0b" prefix and
+// is decimal otherwise (a leading 0 does not mean octal); bases 16, 8 and 2 also
+// accept their own prefix. The sign goes before the prefix: "-0x7f".
+// Returns false on an invalid base, invalid digit, overflow, or no digits.
+SV_NODISCARD SVDEF bool sv_to_uint64_base(StringView sv, int base, uint64_t *out) SV_NOEXCEPT;
+SV_NODISCARD SVDEF bool sv_to_int64_base(StringView sv, int base, int64_t *out) SV_NOEXCEPT;
+
+// Decode pairs of hex digits (either case) into out, e.g. a 32-digit trace ID into
+// 16 bytes. Returns the number of bytes written, sv.length/2, or SV_NPOS if sv
+// has odd length, a non-hex byte, or does not fit in out_size bytes.
+SV_NODISCARD SVDEF size_t sv_hex_decode(StringView sv, unsigned char *out, size_t out_size) SV_NOEXCEPT;
+
 // Strict decimal floating-point parse. Format: [sign]digits[.digits][e[+-]digits].
 // Uses . as decimal separator. No whitespace, no inf/nan.
-// Returns false on invalid syntax, NaN, or overflow after exponent scaling.
-// Note: If the integer part has more than ~20 decimal digits and no exponent is present,
-//       excess high-order digits are ignored (the result reflects the leading digits only).
-//       If you require overflow rejection in that case, normalize inputs to use an
-//       exponent or pre-validate length.
+// Returns false on invalid syntax or if the value rounds to infinity; underflow gives (signed) zero.
+// The result is correctly rounded (nearest, ties to even) for any number of digits.
 SV_NODISCARD SVDEF bool sv_to_double(StringView sv, double *out) SV_NOEXCEPT;
 
+// Parse the number at the start of sv and stop at the first byte that cannot
+// continue it, storing the number of bytes used in *out_consumed (may be NULL).
+// Same grammar and overflow rules as sv_to_*; a '.' or exponent that is not
+// followed by digits is not consumed ("2.x" and "2e+" parse as 2, consuming 1).
+// On failure *out is untouched and *out_consumed is 0.
+SV_NODISCARD SVDEF bool sv_parse_uint64_prefix(StringView sv, uint64_t *out, size_t *out_consumed) SV_NOEXCEPT;
+SV_NODISCARD SVDEF bool sv_parse_int64_prefix(StringView sv, int64_t *out, size_t *out_consumed) SV_NOEXCEPT;
+SV_NODISCARD SVDEF bool sv_parse_double_prefix(StringView sv, double *out, size_t *out_consumed) SV_NOEXCEPT;
+
+// Parse the number at the start of *sv and advance *sv past it. On failure *sv is unchanged.
+//   StringView in = SV_LIT("12.5ms");
+//   double     v;
+//   if (sv_parse_double_and_consume(&in, &v)) { ... in is now "ms" ... }
+SV_NODISCARD SVDEF bool sv_parse_uint64_and_consume(StringView *sv, uint64_t *out) SV_NOEXCEPT;
+SV_NODISCARD SVDEF bool sv_parse_int64_and_consume(StringView *sv, int64_t *out) SV_NOEXCEPT;
+SV_NODISCARD SVDEF bool sv_parse_double_and_consume(StringView *sv, double *out) SV_NOEXCEPT;
+
+// Parse values[0..count) with the rules of sv_to_int64/sv_to_double into out[0..count).
+// Invalid values are stored as 0 and have their bit cleared in validity (may be NULL),
+// an LSB-first bitmap of (count+7)/8 bytes where bit i is set if values[i] parsed.
+// Returns the index of the first invalid value, or SV_NPOS if all parsed.
+SV_NODISCARD SVDEF size_t sv_parse_int64_batch(const StringView *values,
+                                               size_t            count,
+                                               int64_t          *out,
+                                               uint8_t          *validity) SV_NOEXCEPT;
+SV_NODISCARD SVDEF size_t sv_parse_double_batch(const StringView *values,
+                                                size_t            count,
+                                                double           *out,
+                                                uint8_t          *validity) SV_NOEXCEPT;
+
+// Like the _batch functions, for the delim-separated fields of sv (split as by
+// sv_split_into). Parses up to cap fields and returns how many were parsed.
+// *out_next is set as by sv_split_into and *out_first_error (may be NULL) to the
+// index of the first invalid field or SV_NPOS.
+SV_NODISCARD SVDEF size_t sv_parse_int64_fields(StringView  sv,
+                                                char        delim,
+                                                int64_t    *out,
+                                                uint8_t    *validity,
+                                                size_t      cap,
+                                                size_t     *out_next,
+                                                size_t     *out_first_error) SV_NOEXCEPT;
+SV_NODISCARD SVDEF size_t sv_parse_double_fields(StringView  sv,
+                                                 char        delim,
+                                                 double     *out,
+                                                 uint8_t    *validity,
+                                                 size_t      cap,
+                                                 size_t     *out_next,
+                                                 size_t     *out_first_error) SV_NOEXCEPT;
+
+// Buffer sizes that always fit the output of sv_fmt_*: "-9223372036854775808",
+// and a sign, "0.00000" and 17 digits.
+#define SV_FMT_INT64_LEN  20
+#define SV_FMT_DOUBLE_LEN 25
+
+// Format value in decimal into buffer and return a view of the written bytes.
+// Locale-independent and allocation-free; no '\0' is written. Returns an empty
+// view (and writes nothing) if the result does not fit in buffer_size bytes.
+SV_NODISCARD SVDEF StringView sv_fmt_uint64(uint64_t value, char *buffer, size_t buffer_size) SV_NOEXCEPT;
+SV_NODISCARD SVDEF StringView sv_fmt_int64(int64_t value, char *buffer, size_t buffer_size) SV_NOEXCEPT;
+
+// Shortest digits that parse back (with sv_to_double/strtod) to exactly value.
+// Fixed notation for exponents from -6 to 20 ("0.000001", "123.5"), otherwise
+// "1e-7" or "1.5e+300". Writes "-0", "inf", "-inf" and "nan" for the special values.
+SV_NODISCARD SVDEF StringView sv_fmt_double(double value, char *buffer, size_t buffer_size) SV_NOEXCEPT;
+
 
 
 //
 // Utility
 //
 
-// FNV-1a 64-bit hash. Not cryptographically secure.
+// Default hash: FNV-1a, or sv_hash64_seeded(sv, 0) if SV_HASH_WYHASH is defined.
+// FNV-1a values are stable across versions and may be persisted; use
+// sv_hash_fnv1a() directly for that so the config macro cannot change them.
 SV_NODISCARD SVDEF uint64_t sv_hash(StringView sv) SV_NOEXCEPT;
 
+// FNV-1a 64-bit hash, one byte per step. Not cryptographically secure.
+// The offset basis is 1469598103934665603, not the published 14695981039346656037,
+// so values differ from other FNV-1a implementations (kept for compatibility).
+SV_NODISCARD SVDEF uint64_t sv_hash_fnv1a(StringView sv) SV_NOEXCEPT;
+
+// wyhash (final4): 16-48 bytes per step, with overlapping loads for short keys
+// and far better mixing than FNV-1a. Pick a random seed per process for tables
+// that hash untrusted keys. Not cryptographically secure.
+SV_NODISCARD SVDEF uint64_t sv_hash64_seeded(StringView sv, uint64_t seed) SV_NOEXCEPT;
+
+typedef struct {
+    uint64_t lo;
+    uint64_t hi;
+} SvHash128;
+
+// 128-bit fingerprint: lo is sv_hash64_seeded(sv, seed), hi is an independent
+// wyhash lane with different secrets. About half the speed of the 64-bit hash.
+SV_NODISCARD SVDEF SvHash128 sv_hash128_seeded(StringView sv, uint64_t seed) SV_NOEXCEPT;
+
+// Hash keys[0..n) into out[0..n), with out[i] == sv_hash(keys[i]). FNV-1a
+// hashes several keys at once so their multiplies overlap, which pays off for
+// batches of short keys; SV_HASH_WYHASH builds hash them in turn.
+SVDEF void sv_hash_batch(const StringView *keys, size_t n, uint64_t *out) SV_NOEXCEPT;
+
+// Incremental hashing of a key that arrives in pieces. After updates with the
+// pieces in order, final gives the one-shot hash of their concatenation:
+// sv_hash_fnv1a() for SV_HASHER_FNV1A (the default sv_hash()) or
+// sv_hash64_seeded(key, seed) for SV_HASHER_WYHASH. Fields are internal.
+//   SvHasher h;
+//   sv_hasher_init(&h, SV_HASHER_WYHASH, seed);
+//   sv_hasher_update(&h, first_chunk_tail);
+//   sv_hasher_update(&h, next_chunk_head);
+//   uint64_t hash = sv_hasher_final(&h);
+typedef enum {
+    SV_HASHER_FNV1A,
+    SV_HASHER_WYHASH
+} SvHasherKind;
+
+typedef struct {
+    SvHasherKind  kind;
+    uint64_t      state[3];    // FNV-1a hash, or the wyhash lanes
+    uint64_t      length;
+    size_t        pending;     // buffered bytes, after 16 bytes of history
+    unsigned char buffer[64];
+} SvHasher;
+
+// seed is ignored by SV_HASHER_FNV1A.
+SVDEF void sv_hasher_init(SvHasher *hasher, SvHasherKind kind, uint64_t seed) SV_NOEXCEPT;
+SVDEF void sv_hasher_update(SvHasher *hasher, StringView sv) SV_NOEXCEPT;
+// Hash of everything so far. Does not modify the hasher, so more updates may follow.
+SV_NODISCARD SVDEF uint64_t sv_hasher_final(const SvHasher *hasher) SV_NOEXCEPT;
+
+// CRC32C (Castagnoli, as in iSCSI, ext4 and SSE4.2). Pass 0 to start, or a
+// previous result to continue it: sv_crc32c(b, sv_crc32c(a, 0)) is the CRC of a
+// followed by b. Uses the SSE4.2 crc32 instruction over three interleaved
+// streams, or slicing-by-8 tables without it.
+SV_NODISCARD SVDEF uint32_t sv_crc32c(StringView sv, uint32_t seed) SV_NOEXCEPT;
+
 // Write raw bytes (not NULL-terminated) to FILE* with fwrite().
 // Returns false on any error.
 #if SV_HAS_PRINT
@@ -291,6 +801,163 @@ SV_NODISCARD SVDEF bool sv_print(StringView sv, FILE *f) SV_NOEXCEPT;
 #endif
 
 
+
+//
+// Hash map
+//
+
+// Open-addressing StringView -> void* map (SwissTable layout). Slots are probed
+// a group of 16 control bytes at a time, each holding 7 bits of the key's hash,
+// so one SIMD compare filters a whole group. Slots also keep the full hash, so
+// sv_eq() only runs on real candidates. Like SvSearcher, key bytes are not
+// copied and must outlive the map. Fields are internal.
+typedef struct {
+    StringView key;
+    uint64_t   hash;
+    void      *value;
+} SvMapSlot;
+
+typedef struct {
+    unsigned char *ctrl;        // capacity control bytes: empty, deleted or 7 hash bits
+    SvMapSlot     *slots;
+    size_t         capacity;    // 0 or a power of two >= 16
+    size_t         count;
+    size_t         growth_left; // inserts into empty slots before a rehash
+    uint64_t       seed;
+    SvAllocator    allocator;
+} SvMap;
+
+// Initialize a map with room for capacity entries before it rehashes (0 delays
+// allocation to the first insert). Keys are hashed with sv_hash64_seeded(key, seed);
+// use a random seed for untrusted keys. allocator may be NULL.
+// Returns false if allocation fails.
+SV_NODISCARD SVDEF bool sv_map_init(SvMap             *map,
+                                    size_t             capacity,
+                                    uint64_t           seed,
+                                    const SvAllocator *allocator) SV_NOEXCEPT;
+SVDEF void sv_map_free(SvMap *map) SV_NOEXCEPT;
+
+// Remove all entries, keeping the allocation.
+SVDEF void sv_map_clear(SvMap *map) SV_NOEXCEPT;
+
+// Make room for count entries in total. Returns false if allocation fails.
+SV_NODISCARD SVDEF bool sv_map_reserve(SvMap *map, size_t count) SV_NOEXCEPT;
+
+// Insert key or overwrite its value. Returns false if allocation fails, in which
+// case the map is unchanged.
+SV_NODISCARD SVDEF bool sv_map_insert(SvMap *map, StringView key, void *value) SV_NOEXCEPT;
+
+// Pointer to the value stored for key, or NULL if absent. Valid until the next
+// insert, reserve or free.
+SV_NODISCARD SVDEF void **sv_map_find(const SvMap *map, StringView key) SV_NOEXCEPT;
+SV_NODISCARD SVDEF bool sv_map_contains(const SvMap *map, StringView key) SV_NOEXCEPT;
+
+// Remove key. Returns false if it was absent.
+SVDEF bool sv_map_remove(SvMap *map, StringView key) SV_NOEXCEPT;
+
+// Iterate entries in unspecified order. Start with *cursor = 0.
+//   size_t cursor = 0; StringView key; void *value;
+//   while (sv_map_next(&map, &cursor, &key, &value)) { ... }
+SV_NODISCARD SVDEF bool sv_map_next(const SvMap *map,
+                                    size_t      *cursor,
+                                    StringView  *out_key,
+                                    void       **out_value) SV_NOEXCEPT;
+
+
+//
+// String interning
+//
+
+// Deduplicates strings into dense IDs 0, 1, 2, ... in first-seen order. Each
+// unique string is copied once into an arena of large blocks, followed by a
+// '\0', and never moves, so interned views of equal strings have the same
+// begin pointer and can be compared by pointer or ID instead of sv_eq().
+// Memory per unique string is its length + 1 plus 55-110 bytes of index,
+// depending on how full the index is.
+// Fields are internal.
+typedef struct {
+    SvMap        index;           // canonical view -> id
+    StringView  *views;           // id -> canonical view
+    size_t       count;
+    size_t       views_capacity;
+    void        *blocks;          // arena blocks, newest first
+    char        *arena;           // free space in the newest block
+    size_t       arena_left;
+    SvAllocator  allocator;
+} SvInternPool;
+
+// Arena block size, unless pre-sized larger. Longer strings get their own block.
+#ifndef SV_INTERN_BLOCK_SIZE
+#define SV_INTERN_BLOCK_SIZE 65536
+#endif
+
+// Initialize a pool pre-sized for strings unique strings totalling bytes bytes
+// (both may be 0), so filling it up to that does not allocate. The index hashes
+// with sv_hash64_seeded(sv, seed); use a random seed for untrusted strings.
+// allocator may be NULL. Returns false if allocation fails.
+SV_NODISCARD SVDEF bool sv_intern_pool_init(SvInternPool      *pool,
+                                            size_t             strings,
+                                            size_t             bytes,
+                                            uint64_t           seed,
+                                            const SvAllocator *allocator) SV_NOEXCEPT;
+SVDEF void sv_intern_pool_free(SvInternPool *pool) SV_NOEXCEPT;
+
+// Intern sv, copying it on first sight. Stores its ID in *out_id and the canonical
+// view in *out_view (either may be NULL). Returns false if allocation fails or
+// the pool already holds UINT32_MAX strings.
+SV_NODISCARD SVDEF bool sv_intern(SvInternPool *pool,
+                                  StringView    sv,
+                                  uint32_t     *out_id,
+                                  StringView   *out_view) SV_NOEXCEPT;
+
+// Look sv up without interning it. Returns false if it was never interned.
+SV_NODISCARD SVDEF bool sv_intern_find(const SvInternPool *pool, StringView sv, uint32_t *out_id) SV_NOEXCEPT;
+
+// Canonical view of an ID. id must be less than pool->count.
+SV_NODISCARD SVDEF StringView sv_intern_view(const SvInternPool *pool, uint32_t id) SV_NOEXCEPT;
+
+
+//
+// Perfect hashing
+//
+
+// Minimal perfect hash over a fixed set of keys (PTHash-style). Keys are split
+// into buckets by hash, and each bucket stores a 16-bit pilot, found at build time,
+// that sends its keys to distinct positions 0..count-1 (positions from the few
+// spare slots past count are remapped). A lookup is one sv_hash64_seeded, a pilot
+// read and a single sv_eq against the only key that can match. Besides one
+// entry per key, metadata is under a byte per key. Like SvSearcher, key bytes
+// must outlive the table. The key array itself is copied. Fields are internal.
+typedef struct {
+    StringView key;
+    size_t     index;   // position in the keys array passed to sv_phf_init()
+} SvPhfEntry;
+
+typedef struct {
+    size_t            count;
+    size_t            slot_count;     // > count, positions >= count go through remap
+    size_t            bucket_count;
+    uint64_t          seed;
+    const uint16_t   *pilots;
+    const uint32_t   *remap;
+    const SvPhfEntry *entries;        // by position
+    void             *memory;
+    size_t            memory_size;
+    SvAllocator       allocator;
+} SvPhf;
+
+// Build the hash for keys[0..count). allocator may be NULL. Returns false if
+// allocation fails, keys contains duplicates, or count exceeds UINT32_MAX.
+SV_NODISCARD SVDEF bool sv_phf_init(SvPhf             *phf,
+                                    const StringView  *keys,
+                                    size_t             count,
+                                    const SvAllocator *allocator) SV_NOEXCEPT;
+SVDEF void sv_phf_free(SvPhf *phf) SV_NOEXCEPT;
+
+// Index of the key equal to sv in the array the table was built from, or SV_NPOS.
+SV_NODISCARD SVDEF size_t sv_phf_lookup(const SvPhf *phf, StringView sv) SV_NOEXCEPT;
+
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
@@ -307,235 +974,529 @@ SV_NODISCARD SVDEF std::string_view sv_to_std_sv(StringView sv) SV_NOEXCEPT_IF(n
 #endif
 
 
-#ifdef SV_IMPLEMENTATION
-
-#include <ctype.h>
-#include <limits.h>
-#include <string.h>
+//
+// C++ compile-time helpers
+//
 
+#ifdef SV_CONSTEXPR_CPP
 
-// memrchr is a GNU extension, so we make our own
-static inline void *
-sv_memrchr_(const void *s, int c, size_t n)
+// constexpr counterparts of sv_eq, sv_starts_with, sv_ends_with and the hashes,
+// returning the same results, for views of literals (SV_LIT) in constant expressions:
+//   static_assert(sv_hash_ct(SV_LIT("GET")) == ..., "");
+constexpr bool
+sv_eq_ct(StringView a, StringView b) noexcept
 {
-    const unsigned char *p = (const unsigned char *)s + n;
-    while (n--) {
-        if (*--p == (unsigned char)c) return (void *)p;
+    if (a.length != b.length) return false;
+    for (size_t i = 0; i < a.length; ++i) {
+        if (a.begin[i] != b.begin[i]) return false;
     }
-    return NULL;
+    return true;
 }
 
-
-
-SVDEF StringView
-sv_empty(SV_NO_PARAMS) SV_NOEXCEPT
+constexpr bool
+sv_starts_with_ct(StringView sv, StringView prefix) noexcept
 {
-
-#ifndef __cplusplus
-    StringView result = {0};
-#else
-    StringView result = {};
-#endif
-
-    return result;
+    return prefix.length <= sv.length && sv_eq_ct(StringView{sv.begin, prefix.length}, prefix);
 }
 
-SVDEF StringView
-sv_from_cstr(const char *cstr) SV_NOEXCEPT
+constexpr bool
+sv_ends_with_ct(StringView sv, StringView suffix) noexcept
 {
-    if (!cstr) return sv_empty();
-
-    StringView sv = sv_empty();
-    sv.begin  = cstr;
-    sv.length = strlen(cstr);
-    return sv;
+    return suffix.length <= sv.length && sv_eq_ct(StringView{sv.begin + sv.length - suffix.length, suffix.length}, suffix);
 }
 
-SVDEF StringView
-sv_from_parts(const char *begin, size_t length) SV_NOEXCEPT
+constexpr uint64_t
+sv_hash_fnv1a_ct(StringView sv) noexcept
 {
-    SV_ASSERT(begin != NULL || length == 0);
-
-    StringView sv = sv_empty();
-    sv.begin  = begin;
-    sv.length = length;
-    return sv;
+    uint64_t hash = 1469598103934665603ULL;
+    for (size_t i = 0; i < sv.length; ++i) {
+        hash ^= (unsigned char)sv.begin[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
 }
 
-SVDEF char
-sv_at(StringView sv, size_t i) SV_NOEXCEPT
+// n little-endian bytes at p
+constexpr uint64_t
+sv_load_le_ct_(const char *p, size_t n) noexcept
 {
-    SV_ASSERT(i < sv.length);
-    return sv.begin[i];
+    uint64_t v = 0;
+    for (size_t i = 0; i < n; ++i) v |= (uint64_t)(unsigned char)p[i] << (8 * i);
+    return v;
 }
 
-SVDEF char
-sv_first(StringView sv) SV_NOEXCEPT
+// Same as sv_mul128_, from 32x32 partial products
+constexpr uint64_t
+sv_mum_ct_(uint64_t a, uint64_t b, uint64_t *hi) noexcept
 {
-    SV_ASSERT(sv.length > 0);
-    return sv.begin[0];
+    const uint64_t a_lo = (uint32_t)a, a_hi = a >> 32;
+    const uint64_t b_lo = (uint32_t)b, b_hi = b >> 32;
+    const uint64_t ll = a_lo * b_lo, lh = a_lo * b_hi, hl = a_hi * b_lo, hh = a_hi * b_hi;
+    const uint64_t mid = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+    *hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+    return (mid << 32) | (uint32_t)ll;
 }
 
-SVDEF char
-sv_last(StringView sv) SV_NOEXCEPT
+constexpr uint64_t
+sv_wymix_ct_(uint64_t a, uint64_t b) noexcept
 {
-    SV_ASSERT(sv.length > 0);
-    return sv.begin[sv.length-1];
+    uint64_t hi = 0;
+    const uint64_t lo = sv_mum_ct_(a, b, &hi);
+    return lo ^ hi;
 }
 
-SVDEF StringView
-sv_substr(StringView sv, size_t pos, size_t count) SV_NOEXCEPT
+// Same as sv_hash64_seeded (wyhash final4)
+constexpr uint64_t
+sv_hash64_seeded_ct(StringView sv, uint64_t seed) noexcept
 {
-    SV_ASSERT(pos <= sv.length);
-    SV_ASSERT(count <= sv.length - pos);
-
-    StringView result = sv_empty();
-    result.begin = sv.begin + pos;
-    result.length = count;
+    const uint64_t s0 = 0x2d358dccaa6c78a5ULL, s1 = 0x8bb84b93962eacc9ULL;
+    const uint64_t s2 = 0x4b33a62ed433d4a3ULL, s3 = 0x4d5a2da51de1aa47ULL;
+    const char    *p  = sv.begin;
+    const size_t   n  = sv.length;
+    uint64_t       a = 0, b = 0;
+
+    seed ^= sv_wymix_ct_(seed ^ s0, s1);
+    if (n <= 16) {
+        if (n >= 4) {
+            const size_t mid = (n >> 3) << 2;
+            a = (sv_load_le_ct_(p, 4) << 32) | sv_load_le_ct_(p + mid, 4);
+            b = (sv_load_le_ct_(p + n - 4, 4) << 32) | sv_load_le_ct_(p + n - 4 - mid, 4);
+        } else if (n > 0) {
+            a = ((uint64_t)(unsigned char)p[0] << 16) | ((uint64_t)(unsigned char)p[n >> 1] << 8) |
+                (uint64_t)(unsigned char)p[n - 1];
+        }
+    } else {
+        size_t i = n;
+        if (i >= 48) {
+            uint64_t see1 = seed, see2 = seed;
+            do {
+                seed = sv_wymix_ct_(sv_load_le_ct_(p, 8) ^ s1, sv_load_le_ct_(p + 8, 8) ^ seed);
+                see1 = sv_wymix_ct_(sv_load_le_ct_(p + 16, 8) ^ s2, sv_load_le_ct_(p + 24, 8) ^ see1);
+                see2 = sv_wymix_ct_(sv_load_le_ct_(p + 32, 8) ^ s3, sv_load_le_ct_(p + 40, 8) ^ see2);
+                p += 48;
+                i -= 48;
+            } while (i >= 48);
+            seed ^= see1 ^ see2;
+        }
+        while (i > 16) {
+            seed = sv_wymix_ct_(sv_load_le_ct_(p, 8) ^ s1, sv_load_le_ct_(p + 8, 8) ^ seed);
+            p += 16;
+            i -= 16;
+        }
+        a = sv_load_le_ct_(p + i - 16, 8);
+        b = sv_load_le_ct_(p + i - 8, 8);
+    }
 
-    return result;
+    a = sv_mum_ct_(a ^ s1, b ^ seed, &b);
+    return sv_wymix_ct_(a ^ s0 ^ n, b ^ s1);
 }
 
-SVDEF bool
-sv_eq(StringView sv1, StringView sv2) SV_NOEXCEPT
+// Same as sv_hash, including the SV_HASH_WYHASH switch
+constexpr uint64_t
+sv_hash_ct(StringView sv) noexcept
 {
-    if (sv1.length != sv2.length) return false;
-    if (sv1.length == 0) return true;
-
-    return memcmp(sv1.begin, sv2.begin, sv1.length) == 0;
+#ifdef SV_HASH_WYHASH
+    return sv_hash64_seeded_ct(sv, 0);
+#else
+    return sv_hash_fnv1a_ct(sv);
+#endif
 }
 
-SVDEF bool
-sv_eq_cstr(StringView sv, const char *cstr) SV_NOEXCEPT
+// Smallest power of two >= n, at least 2, and its log2
+constexpr size_t
+sv_pow2_ct_(size_t n) noexcept
 {
-    if (!cstr) return false;
-
-    size_t length = strlen(cstr);
-    return sv_eq_cstr_n(sv, cstr, length);
+    size_t p = 2;
+    while (p < n) p *= 2;
+    return p;
 }
 
-SVDEF bool
-sv_eq_cstr_n(StringView sv, const char *cstr, size_t length) SV_NOEXCEPT
+constexpr unsigned
+sv_log2_ct_(size_t p) noexcept
 {
-    if (!cstr) return false;
-
-    if (sv.length != length) return false;
-    return sv.length == 0 || memcmp(sv.begin, cstr, length) == 0;
+    unsigned bits = 0;
+    while (((size_t)1 << bits) < p) ++bits;
+    return bits;
 }
 
-SVDEF bool
-sv_is_empty(StringView sv) SV_NOEXCEPT
+// A keyword set with a perfect hash built at compile time by sv_keywords().
+// Keys are split into buckets by the top hash bits, and each bucket gets a
+// pilot value, found by trial, that maps its keys to free slots (PTHash-style).
+// A lookup is one sv_hash64_seeded, two table reads and one sv_eq.
+template <size_t N>
+struct SvKeywords {
+    static constexpr size_t   bucket_count = sv_pow2_ct_(N / 2);
+    static constexpr size_t   slot_count   = sv_pow2_ct_(2 * N);
+    static constexpr unsigned bucket_bits  = sv_log2_ct_(bucket_count);
+    static constexpr unsigned slot_bits    = sv_log2_ct_(slot_count);
+
+    StringView words[N];
+    uint16_t   pilots[bucket_count];
+    uint32_t   slots[slot_count]; // keyword index + 1, or 0
+};
+
+constexpr uint64_t
+sv_keyword_slot_ct_(uint64_t hash, uint64_t pilot, unsigned slot_bits) noexcept
 {
-    return sv.length == 0;
+    return ((hash ^ (pilot * 0x9E3779B97F4A7C15ULL)) * 0xff51afd7ed558ccdULL) >> (64 - slot_bits);
 }
 
-SVDEF bool
-sv_starts_with(StringView sv, StringView prefix) SV_NOEXCEPT
+// Deliberately not constexpr: reaching it in a constant expression is a compile error
+inline void sv_keywords_error_duplicate_or_too_many_() noexcept {}
+
+// Build the keyword table. Use it as a static constexpr variable so the search
+// runs at compile time:
+//   static constexpr auto methods = sv_keywords("GET", "POST", "PUT");
+//   switch (sv_keywords_find(methods, sv)) { case 0: ... case SV_NPOS: ... }
+// Duplicate keywords fail to compile.
+template <size_t... L>
+constexpr SvKeywords<sizeof...(L)>
+sv_keywords(const char (&...words)[L]) noexcept
 {
-    if (prefix.length > sv.length) return 0;
+    constexpr size_t   n           = sizeof...(L);
+    constexpr size_t   bucket_cnt  = SvKeywords<n>::bucket_count;
+    constexpr size_t   slot_cnt    = SvKeywords<n>::slot_count;
+    constexpr unsigned bucket_bits = SvKeywords<n>::bucket_bits;
+    constexpr unsigned slot_bits   = SvKeywords<n>::slot_bits;
+
+    SvKeywords<n> table{};
+    const StringView list[n] = { StringView{ words, L - 1 }... };
+    uint64_t hashes[n] = {};
+    size_t   bucket_size[bucket_cnt] = {};
+    size_t   largest = 0;
+    for (size_t i = 0; i < n; ++i) {
+        table.words[i] = list[i];
+        hashes[i]      = sv_hash64_seeded_ct(list[i], 0);
+        const size_t b = (size_t)(hashes[i] >> (64 - bucket_bits));
+        bucket_size[b] += 1;
+        if (bucket_size[b] > largest) largest = bucket_size[b];
+    }
 
-    return memcmp(sv.begin, prefix.begin, prefix.length) == 0;
+    // Largest buckets first, while most slots are still free
+    for (size_t size = largest; size > 0; --size) {
+        for (size_t b = 0; b < bucket_cnt; ++b) {
+            if (bucket_size[b] != size) continue;
+
+            bool placed = false;
+            for (uint64_t pilot = 0; pilot < 65536 && !placed; ++pilot) {
+                placed = true;
+                for (size_t i = 0; i < n && placed; ++i) {
+                    if ((size_t)(hashes[i] >> (64 - bucket_bits)) != b) continue;
+                    const size_t slot = (size_t)sv_keyword_slot_ct_(hashes[i], pilot, slot_bits);
+                    if (table.slots[slot]) {
+                        placed = false;
+                        // Undo this bucket's keys placed so far with this pilot
+                        for (size_t j = 0; j < slot_cnt; ++j) {
+                            if (table.slots[j] && (size_t)(hashes[table.slots[j] - 1] >> (64 - bucket_bits)) == b) table.slots[j] = 0;
+                        }
+                    } else {
+                        table.slots[slot] = (uint32_t)(i + 1);
+                    }
+                }
+                if (placed) table.pilots[b] = (uint16_t)pilot;
+            }
+            if (!placed) sv_keywords_error_duplicate_or_too_many_();
+        }
+    }
+    return table;
 }
 
-SVDEF bool
-sv_ends_with(StringView sv, StringView suffix) SV_NOEXCEPT
+// Index of the keyword equal to sv, or SV_NPOS.
+template <size_t N>
+SV_NODISCARD inline size_t
+sv_keywords_find(const SvKeywords<N> &table, StringView sv) noexcept
 {
-    if (suffix.length > sv.length) return 0;
-
-    const size_t offset = sv.length - suffix.length;
-    return memcmp(sv.begin + offset, suffix.begin, suffix.length) == 0;
+    const uint64_t hash  = sv_hash64_seeded(sv, 0);
+    const uint16_t pilot = table.pilots[hash >> (64 - SvKeywords<N>::bucket_bits)];
+    const uint32_t index = table.slots[sv_keyword_slot_ct_(hash, pilot, SvKeywords<N>::slot_bits)];
+    return index && sv_eq(table.words[index - 1], sv) ? (size_t)index - 1 : SV_NPOS;
 }
 
-SVDEF size_t
-sv_find_char(StringView sv, char c) SV_NOEXCEPT
-{
-    if (sv.length == 0) return SV_NPOS;
+// Index of the keyword equal to sv among the string literals that follow, or
+// SV_NPOS. The table is built once at compile time:
+//   switch (sv_switch(method, "GET", "POST", "PUT")) {
+//   case 0: ...  // GET
+//   case 1: ...  // POST
+//   }
+#define sv_switch(sv, ...)                                                          \
+    ([](StringView sv_switch_key_) noexcept {                                       \
+        static constexpr auto sv_switch_table_ = sv_keywords(__VA_ARGS__);         \
+        return sv_keywords_find(sv_switch_table_, sv_switch_key_);                  \
+    }(sv))
 
-    const void *p = memchr(sv.begin, (unsigned char)c, sv.length);
-    return p ? (size_t)((const char *)p - sv.begin) : SV_NPOS;
-}
+#endif // SV_CONSTEXPR_CPP
 
-SVDEF size_t
-sv_rfind_char(StringView sv, char c) SV_NOEXCEPT
-{
-    if (sv.length == 0) return SV_NPOS;
 
-    const void *p = sv_memrchr_(sv.begin, (unsigned char)c, sv.length);
-    return p ? (size_t)((const char *)p - sv.begin) : SV_NPOS;
-}
+#ifdef SV_IMPLEMENTATION
 
-SVDEF size_t
-sv_find_char_from(StringView sv, size_t pos, char c) SV_NOEXCEPT
-{
-    if (sv.length == 0)  return SV_NPOS;
-    if (pos > sv.length) pos = sv.length;
+#include <ctype.h>
+#include <limits.h>
+#include <string.h>
 
-    const void *p = memchr(sv.begin + pos, (unsigned char)c, sv.length - pos);
-    return p ? (size_t)((const char *)p - sv.begin) : SV_NPOS;
-}
+#if SV_HAS_AVX2
+#include <immintrin.h>
+#elif SV_HAS_SSE42
+#include <nmmintrin.h>
+#elif SV_HAS_SSSE3
+#include <tmmintrin.h>
+#elif SV_HAS_SSE2
+#include <emmintrin.h>
+#endif
 
-SVDEF size_t
-sv_rfind_char_from(StringView sv, size_t pos, char c) SV_NOEXCEPT
-{
-    if (sv.length == 0)   return SV_NPOS;
-    if (pos >= sv.length) pos = sv.length-1;
+#if SV_HAS_PCLMUL && !SV_HAS_AVX2
+#include <wmmintrin.h>
+#endif
 
-    const void *p = sv_memrchr_(sv.begin, (unsigned char)c, pos+1);
-    return p ? (size_t)((const char *)p - sv.begin) : SV_NPOS;
+#ifndef SV_MALLOC
+#include <stdlib.h>
+#define SV_MALLOC(size) malloc((size))
+#endif
+
+#ifndef SV_FREE
+#include <stdlib.h>
+#define SV_FREE(ptr) free((ptr))
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+
+// Index of the lowest set bit. x must be non-zero.
+static inline unsigned
+sv_ctz32_(uint32_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_ctz(x);
+#elif defined(_MSC_VER)
+    unsigned long idx;
+    _BitScanForward(&idx, x);
+    return (unsigned)idx;
+#else
+    unsigned n = 0;
+    while (!(x & 1u)) { x >>= 1; n += 1; }
+    return n;
+#endif
 }
 
-SVDEF size_t
-sv_find_substr(StringView hay, StringView needle) SV_NOEXCEPT
+static inline unsigned
+sv_ctz64_(uint64_t x)
 {
-    if (needle.length == 0)         return 0;
-    if (needle.length > hay.length) return SV_NPOS;
+    const uint32_t lo = (uint32_t)x;
+    return lo ? sv_ctz32_(lo) : 32u + sv_ctz32_((uint32_t)(x >> 32));
+}
 
-    const unsigned char first_char = (unsigned char)needle.begin[0];
-    const size_t        last_start = hay.length - needle.length;
+// Index of the highest set bit. x must be non-zero.
+static inline unsigned
+sv_msb32_(uint32_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return 31u - (unsigned)__builtin_clz(x);
+#elif defined(_MSC_VER)
+    unsigned long idx;
+    _BitScanReverse(&idx, x);
+    return (unsigned)idx;
+#else
+    unsigned n = 31;
+    while (!(x & 0x80000000u)) { x <<= 1; n -= 1; }
+    return n;
+#endif
+}
 
-    for (size_t i = 0; i <= last_start;) {
-        const void *p = memchr(hay.begin + i, first_char, (last_start - i) + 1);
-        if (!p) return SV_NPOS;
+static inline unsigned
+sv_msb64_(uint64_t x)
+{
+    const uint32_t hi = (uint32_t)(x >> 32);
+    return hi ? 32u + sv_msb32_(hi) : sv_msb32_((uint32_t)x);
+}
 
-        const size_t offset = (size_t)((const char *)p - hay.begin);
-        if (memcmp(hay.begin + offset, needle.begin, needle.length) == 0) return offset;
+// memrchr is a GNU extension, so we make our own.
+// Scans backwards a vector at a time where SIMD is available, then a word at
+// a time (SWAR) for the remainder, then locates the byte inside the word.
+static inline void *
+sv_memrchr_(const void *s, int c, size_t n)
+{
+    const unsigned char *p  = (const unsigned char *)s;
+    const unsigned char  uc = (unsigned char)c;
+
+#if SV_HAS_AVX2
+    const __m256i c32 = _mm256_set1_epi8((char)uc);
+    while (n >= 32) {
+        const __m256i block = _mm256_loadu_si256((const __m256i *)(p + n - 32));
+        const uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, c32));
+        if (mask) return (void *)(p + n - 32 + sv_msb32_(mask));
+        n -= 32;
+    }
+#endif
+#if SV_HAS_SSE2
+    const __m128i c16 = _mm_set1_epi8((char)uc);
+    while (n >= 16) {
+        const __m128i block = _mm_loadu_si128((const __m128i *)(p + n - 16));
+        const uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(block, c16));
+        if (mask) return (void *)(p + n - 16 + sv_msb32_(mask));
+        n -= 16;
+    }
+#endif
 
-        i = offset + 1;
+    // Word-at-a-time: XOR turns matching bytes into zero bytes, and the
+    // classic has-zero-byte test tells us whether this word holds a match.
+    const uint64_t ones    = 0x0101010101010101ULL;
+    const uint64_t highs   = 0x8080808080808080ULL;
+    const uint64_t pattern = ones * uc;
+    while (n >= 8) {
+        uint64_t word;
+        memcpy(&word, p + n - 8, 8);
+        word ^= pattern;
+        if ((word - ones) & ~word & highs) break;
+        n -= 8;
     }
-    return SV_NPOS;
-}
 
+    while (n--) {
+        if (p[n] == uc) return (void *)(p + n);
+    }
+    return NULL;
+}
 
-SVDEF size_t
-sv_rfind_substr(StringView hay, StringView needle) SV_NOEXCEPT
+// memchr()/sv_memrchr_() for any of three bytes (pass a byte twice to search for two).
+// Vector blocks OR the three byte compares together. The SWAR fallback ORs three
+// has-zero-byte tests, each of which is exact about whether the word holds a match.
+static inline const char *
+sv_memchr3_(const char *s, size_t n, unsigned char c1, unsigned char c2, unsigned char c3)
 {
-    if (needle.length == 0)         return hay.length;
-    if (needle.length > hay.length) return SV_NPOS;
+    const unsigned char *p = (const unsigned char *)s;
+    size_t               i = 0;
+
+#if SV_HAS_AVX2
+    {
+        const __m256i v1 = _mm256_set1_epi8((char)c1);
+        const __m256i v2 = _mm256_set1_epi8((char)c2);
+        const __m256i v3 = _mm256_set1_epi8((char)c3);
+        for (; n - i >= 32; i += 32) {
+            const __m256i block = _mm256_loadu_si256((const __m256i *)(p + i));
+            const __m256i eq    = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(block, v1),
+                                                                  _mm256_cmpeq_epi8(block, v2)),
+                                                  _mm256_cmpeq_epi8(block, v3));
+            const uint32_t mask = (uint32_t)_mm256_movemask_epi8(eq);
+            if (mask) return s + i + sv_ctz32_(mask);
+        }
+    }
+#endif
+#if SV_HAS_SSE2
+    {
+        const __m128i v1 = _mm_set1_epi8((char)c1);
+        const __m128i v2 = _mm_set1_epi8((char)c2);
+        const __m128i v3 = _mm_set1_epi8((char)c3);
+        for (; n - i >= 16; i += 16) {
+            const __m128i block = _mm_loadu_si128((const __m128i *)(p + i));
+            const __m128i eq    = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, v1),
+                                                            _mm_cmpeq_epi8(block, v2)),
+                                               _mm_cmpeq_epi8(block, v3));
+            const uint32_t mask = (uint32_t)_mm_movemask_epi8(eq);
+            if (mask) return s + i + sv_ctz32_(mask);
+        }
+    }
+#endif
 
-    const unsigned char first_char = (unsigned char)needle.begin[0];
-    const size_t        last_start = hay.length - needle.length;
+    const uint64_t ones  = 0x0101010101010101ULL;
+    const uint64_t highs = 0x8080808080808080ULL;
+    const uint64_t p1 = ones * c1, p2 = ones * c2, p3 = ones * c3;
+    for (; n - i >= 8; i += 8) {
+        uint64_t word;
+        memcpy(&word, p + i, 8);
+        const uint64_t x1 = word ^ p1, x2 = word ^ p2, x3 = word ^ p3;
+        if ((((x1 - ones) & ~x1) | ((x2 - ones) & ~x2) | ((x3 - ones) & ~x3)) & highs) break;
+    }
 
-    for (size_t i = last_start + 1; i != 0;) {
-        const void *p = sv_memrchr_(hay.begin, first_char, i);
-        if (!p) return SV_NPOS;
+    for (; i < n; ++i) {
+        if (p[i] == c1 || p[i] == c2 || p[i] == c3) return s + i;
+    }
+    return NULL;
+}
 
-        const size_t offset = (size_t)((const char *)p - hay.begin);
-        if (memcmp(hay.begin + offset, needle.begin, needle.length) == 0)
-            return offset;
+static inline const char *
+sv_memrchr3_(const char *s, size_t n, unsigned char c1, unsigned char c2, unsigned char c3)
+{
+    const unsigned char *p = (const unsigned char *)s;
+
+#if SV_HAS_AVX2
+    {
+        const __m256i v1 = _mm256_set1_epi8((char)c1);
+        const __m256i v2 = _mm256_set1_epi8((char)c2);
+        const __m256i v3 = _mm256_set1_epi8((char)c3);
+        for (; n >= 32; n -= 32) {
+            const __m256i block = _mm256_loadu_si256((const __m256i *)(p + n - 32));
+            const __m256i eq    = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(block, v1),
+                                                                  _mm256_cmpeq_epi8(block, v2)),
+                                                  _mm256_cmpeq_epi8(block, v3));
+            const uint32_t mask = (uint32_t)_mm256_movemask_epi8(eq);
+            if (mask) return s + n - 32 + sv_msb32_(mask);
+        }
+    }
+#endif
+#if SV_HAS_SSE2
+    {
+        const __m128i v1 = _mm_set1_epi8((char)c1);
+        const __m128i v2 = _mm_set1_epi8((char)c2);
+        const __m128i v3 = _mm_set1_epi8((char)c3);
+        for (; n >= 16; n -= 16) {
+            const __m128i block = _mm_loadu_si128((const __m128i *)(p + n - 16));
+            const __m128i eq    = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, v1),
+                                                            _mm_cmpeq_epi8(block, v2)),
+                                               _mm_cmpeq_epi8(block, v3));
+            const uint32_t mask = (uint32_t)_mm_movemask_epi8(eq);
+            if (mask) return s + n - 16 + sv_msb32_(mask);
+        }
+    }
+#endif
 
-        i = offset;
+    const uint64_t ones  = 0x0101010101010101ULL;
+    const uint64_t highs = 0x8080808080808080ULL;
+    const uint64_t p1 = ones * c1, p2 = ones * c2, p3 = ones * c3;
+    for (; n >= 8; n -= 8) {
+        uint64_t word;
+        memcpy(&word, p + n - 8, 8);
+        const uint64_t x1 = word ^ p1, x2 = word ^ p2, x3 = word ^ p3;
+        if ((((x1 - ones) & ~x1) | ((x2 - ones) & ~x2) | ((x3 - ones) & ~x3)) & highs) break;
     }
 
-    return SV_NPOS;
+    while (n--) {
+        if (p[n] == c1 || p[n] == c2 || p[n] == c3) return s + n;
+    }
+    return NULL;
 }
 
-SVDEF size_t
-sv_find_substr_from(StringView hay, size_t pos, StringView needle) SV_NOEXCEPT
+// Bit k set if p[k] == c, for a 64-byte block
+static inline uint64_t
+sv_eq_mask64_(const unsigned char *p, unsigned char c)
 {
-    if (pos > hay.length)                 pos = hay.length;
-    if (needle.length == 0)               return pos;
-    if (needle.length > hay.length - pos) return SV_NPOS;
+#if SV_HAS_AVX512
+    return (uint64_t)_mm512_cmpeq_epi8_mask(_mm512_loadu_si512((const void *)p), _mm512_set1_epi8((char)c));
+#elif SV_HAS_AVX2
+    const __m256i v  = _mm256_set1_epi8((char)c);
+    const uint32_t lo = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)p), v));
+    const uint32_t hi = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(p + 32)), v));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+#elif SV_HAS_SSE2
+    const __m128i v  = _mm_set1_epi8((char)c);
+    uint64_t mask = 0;
+    for (unsigned k = 0; k < 4; ++k) {
+        const __m128i block = _mm_loadu_si128((const __m128i *)(p + 16 * k));
+        mask |= (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(block, v)) << (16 * k);
+    }
+    return mask;
+#else
+    uint64_t mask = 0;
+    for (unsigned k = 0; k < 64; ++k) mask |= (uint64_t)(p[k] == c) << k;
+    return mask;
+#endif
+}
 
+// Scalar substring search over the start positions [pos, hay.length - needle.length]:
+// memchr() for the needle's first byte, then memcmp() on every candidate.
+// Requires 0 < needle.length <= hay.length - pos.
+static inline size_t
+sv_find_substr_scalar_(StringView hay, size_t pos, StringView needle)
+{
     const unsigned char first_char = (unsigned char)needle.begin[0];
     const size_t        last_start = hay.length - needle.length;
 
@@ -543,518 +1504,5248 @@ sv_find_substr_from(StringView hay, size_t pos, StringView needle) SV_NOEXCEPT
         const void *p = memchr(hay.begin + i, first_char, (last_start - i) + 1);
         if (!p) return SV_NPOS;
 
-        size_t offset = (size_t)((const char *)p - hay.begin);
-        if (memcmp(hay.begin + offset, needle.begin, needle.length) == 0) {
-            return offset;
-        }
+        const size_t offset = (size_t)((const char *)p - hay.begin);
+        if (memcmp(hay.begin + offset, needle.begin, needle.length) == 0) return offset;
+
         i = offset + 1;
     }
+    return SV_NPOS;
+}
+
+// SIMD substring kernels. Each block compares the needle's first byte against
+// hay[i..i+W) and its last byte against hay[i+m-1..i+m-1+W) at once, so only
+// lanes where both match are verified with memcmp(). This keeps the candidate
+// rate low even when the first byte alone is very common in the haystack.
+//
+// Each kernel scans whole blocks starting at *pos and leaves *pos at the first
+// start position it did not examine. Requires needle.length >= 2.
+#if SV_HAS_AVX512
+static inline size_t
+sv_find_substr_avx512_(StringView hay, size_t *pos, StringView needle)
+{
+    const char   *n     = needle.begin;
+    const size_t  m     = needle.length;
+    const __m512i first = _mm512_set1_epi8(n[0]);
+    const __m512i last  = _mm512_set1_epi8(n[m-1]);
+
+    size_t i = *pos;
+    for (; hay.length - i >= m - 1 + 64; i += 64) {
+        const __m512i block_first = _mm512_loadu_si512((const void *)(hay.begin + i));
+        const __m512i block_last  = _mm512_loadu_si512((const void *)(hay.begin + i + m - 1));
+
+        uint64_t mask = (uint64_t)(_mm512_cmpeq_epi8_mask(first, block_first) &
+                                   _mm512_cmpeq_epi8_mask(last,  block_last));
+        while (mask) {
+            const size_t offset = i + sv_ctz64_(mask);
+            if (memcmp(hay.begin + offset + 1, n + 1, m - 2) == 0) return offset;
+            mask &= mask - 1;
+        }
+    }
+    *pos = i;
+    return SV_NPOS;
+}
+#endif
 
+#if SV_HAS_AVX2
+static inline size_t
+sv_find_substr_avx2_(StringView hay, size_t *pos, StringView needle)
+{
+    const char   *n     = needle.begin;
+    const size_t  m     = needle.length;
+    const __m256i first = _mm256_set1_epi8(n[0]);
+    const __m256i last  = _mm256_set1_epi8(n[m-1]);
+
+    size_t i = *pos;
+    for (; hay.length - i >= m - 1 + 32; i += 32) {
+        const __m256i block_first = _mm256_loadu_si256((const __m256i *)(hay.begin + i));
+        const __m256i block_last  = _mm256_loadu_si256((const __m256i *)(hay.begin + i + m - 1));
+        const __m256i eq          = _mm256_and_si256(_mm256_cmpeq_epi8(first, block_first),
+                                                     _mm256_cmpeq_epi8(last,  block_last));
+
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(eq);
+        while (mask) {
+            const size_t offset = i + sv_ctz32_(mask);
+            if (memcmp(hay.begin + offset + 1, n + 1, m - 2) == 0) return offset;
+            mask &= mask - 1;
+        }
+    }
+    *pos = i;
     return SV_NPOS;
 }
+#endif
 
-SVDEF size_t
-sv_rfind_substr_from(StringView hay, size_t pos, StringView needle) SV_NOEXCEPT
+#if SV_HAS_SSE2
+static inline size_t
+sv_find_substr_sse2_(StringView hay, size_t *pos, StringView needle)
 {
-    if (pos > hay.length)           pos = hay.length;
-    if (needle.length == 0)         return pos;
-    if (needle.length > hay.length) return SV_NPOS;
-    if (pos + 1 < needle.length)    return SV_NPOS;
+    const char   *n     = needle.begin;
+    const size_t  m     = needle.length;
+    const __m128i first = _mm_set1_epi8(n[0]);
+    const __m128i last  = _mm_set1_epi8(n[m-1]);
+
+    size_t i = *pos;
+    for (; hay.length - i >= m - 1 + 16; i += 16) {
+        const __m128i block_first = _mm_loadu_si128((const __m128i *)(hay.begin + i));
+        const __m128i block_last  = _mm_loadu_si128((const __m128i *)(hay.begin + i + m - 1));
+        const __m128i eq          = _mm_and_si128(_mm_cmpeq_epi8(first, block_first),
+                                                  _mm_cmpeq_epi8(last,  block_last));
+
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(eq);
+        while (mask) {
+            const size_t offset = i + sv_ctz32_(mask);
+            if (memcmp(hay.begin + offset + 1, n + 1, m - 2) == 0) return offset;
+            mask &= mask - 1;
+        }
+    }
+    *pos = i;
+    return SV_NPOS;
+}
+#endif
 
-    size_t last_start = hay.length - needle.length;
-    if (pos > last_start) pos = last_start;
+// Forward substring search used by all find/contains functions.
+// Requires 0 < needle.length <= hay.length - pos.
+static inline size_t
+sv_find_substr_(StringView hay, size_t pos, StringView needle)
+{
+    if (needle.length == 1) {
+        const void *p = memchr(hay.begin + pos, (unsigned char)needle.begin[0], hay.length - pos);
+        return p ? (size_t)((const char *)p - hay.begin) : SV_NPOS;
+    }
 
+#if SV_HAS_SSE2
+    size_t found;
+#endif
+#if SV_HAS_AVX512
+    if ((found = sv_find_substr_avx512_(hay, &pos, needle)) != SV_NPOS) return found;
+#endif
+#if SV_HAS_AVX2
+    if ((found = sv_find_substr_avx2_(hay, &pos, needle)) != SV_NPOS) return found;
+#endif
+#if SV_HAS_SSE2
+    if ((found = sv_find_substr_sse2_(hay, &pos, needle)) != SV_NPOS) return found;
+#endif
+    return sv_find_substr_scalar_(hay, pos, needle);
+}
+
+// Scalar reverse substring search over the start positions [0, pos], highest
+// first. Requires needle.length > 0 and pos + needle.length <= hay.length.
+static inline size_t
+sv_rfind_substr_scalar_(StringView hay, size_t pos, StringView needle)
+{
     const unsigned char first_char = (unsigned char)needle.begin[0];
 
-    for (size_t i = pos + 1; i != 0; ) {
+    for (size_t i = pos + 1; i != 0;) {
         const void *p = sv_memrchr_(hay.begin, first_char, i);
         if (!p) return SV_NPOS;
 
-        size_t offset = (size_t)((const char *)p - hay.begin);
-        if (memcmp(hay.begin + offset, needle.begin, needle.length) == 0)
-            return offset;
+        const size_t offset = (size_t)((const char *)p - hay.begin);
+        if (memcmp(hay.begin + offset, needle.begin, needle.length) == 0) return offset;
 
         i = offset;
     }
-
     return SV_NPOS;
 }
 
-SVDEF size_t
-sv_find_substr_cstr(StringView hay, const char *needle) SV_NOEXCEPT
+// Reverse counterparts of the SIMD substring kernels. *end is the number of
+// start positions [0, *end) that are still unexamined; each kernel consumes
+// whole blocks from the top and lowers *end accordingly. Requires needle.length >= 2.
+#if SV_HAS_AVX512
+static inline size_t
+sv_rfind_substr_avx512_(StringView hay, size_t *end, StringView needle)
 {
-    StringView needle_sv = sv_from_cstr(needle);
-    return sv_find_substr(hay, needle_sv);
+    const char   *n     = needle.begin;
+    const size_t  m     = needle.length;
+    const __m512i first = _mm512_set1_epi8(n[0]);
+    const __m512i last  = _mm512_set1_epi8(n[m-1]);
+
+    size_t e = *end;
+    for (; e >= 64; e -= 64) {
+        const size_t  i           = e - 64;
+        const __m512i block_first = _mm512_loadu_si512((const void *)(hay.begin + i));
+        const __m512i block_last  = _mm512_loadu_si512((const void *)(hay.begin + i + m - 1));
+
+        uint64_t mask = (uint64_t)(_mm512_cmpeq_epi8_mask(first, block_first) &
+                                   _mm512_cmpeq_epi8_mask(last,  block_last));
+        while (mask) {
+            const unsigned bit    = sv_msb64_(mask);
+            const size_t   offset = i + bit;
+            if (memcmp(hay.begin + offset + 1, n + 1, m - 2) == 0) return offset;
+            mask &= ~(1ULL << bit);
+        }
+    }
+    *end = e;
+    return SV_NPOS;
 }
+#endif
 
-
-SVDEF size_t
-sv_rfind_substr_cstr(StringView hay, const char *needle) SV_NOEXCEPT
+#if SV_HAS_AVX2
+static inline size_t
+sv_rfind_substr_avx2_(StringView hay, size_t *end, StringView needle)
 {
-    StringView needle_sv = sv_from_cstr(needle);
-    return sv_rfind_substr(hay, needle_sv);
+    const char   *n     = needle.begin;
+    const size_t  m     = needle.length;
+    const __m256i first = _mm256_set1_epi8(n[0]);
+    const __m256i last  = _mm256_set1_epi8(n[m-1]);
+
+    size_t e = *end;
+    for (; e >= 32; e -= 32) {
+        const size_t  i           = e - 32;
+        const __m256i block_first = _mm256_loadu_si256((const __m256i *)(hay.begin + i));
+        const __m256i block_last  = _mm256_loadu_si256((const __m256i *)(hay.begin + i + m - 1));
+        const __m256i eq          = _mm256_and_si256(_mm256_cmpeq_epi8(first, block_first),
+                                                     _mm256_cmpeq_epi8(last,  block_last));
+
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(eq);
+        while (mask) {
+            const unsigned bit    = sv_msb32_(mask);
+            const size_t   offset = i + bit;
+            if (memcmp(hay.begin + offset + 1, n + 1, m - 2) == 0) return offset;
+            mask &= ~(1u << bit);
+        }
+    }
+    *end = e;
+    return SV_NPOS;
 }
+#endif
 
-SVDEF size_t
-sv_find_substr_cstr_from(StringView hay, size_t pos, const char *needle) SV_NOEXCEPT
+#if SV_HAS_SSE2
+static inline size_t
+sv_rfind_substr_sse2_(StringView hay, size_t *end, StringView needle)
 {
-    StringView needle_sv = sv_from_cstr(needle);
-    return sv_find_substr_from(hay, pos, needle_sv);
+    const char   *n     = needle.begin;
+    const size_t  m     = needle.length;
+    const __m128i first = _mm_set1_epi8(n[0]);
+    const __m128i last  = _mm_set1_epi8(n[m-1]);
+
+    size_t e = *end;
+    for (; e >= 16; e -= 16) {
+        const size_t  i           = e - 16;
+        const __m128i block_first = _mm_loadu_si128((const __m128i *)(hay.begin + i));
+        const __m128i block_last  = _mm_loadu_si128((const __m128i *)(hay.begin + i + m - 1));
+        const __m128i eq          = _mm_and_si128(_mm_cmpeq_epi8(first, block_first),
+                                                  _mm_cmpeq_epi8(last,  block_last));
+
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(eq);
+        while (mask) {
+            const unsigned bit    = sv_msb32_(mask);
+            const size_t   offset = i + bit;
+            if (memcmp(hay.begin + offset + 1, n + 1, m - 2) == 0) return offset;
+            mask &= ~(1u << bit);
+        }
+    }
+    *end = e;
+    return SV_NPOS;
 }
+#endif
 
-SVDEF size_t
-sv_rfind_substr_cstr_from(StringView hay, size_t pos, const char *needle) SV_NOEXCEPT
+// Reverse substring search used by all rfind functions: last match starting
+// at or before pos. Requires needle.length > 0 and pos + needle.length <= hay.length.
+static inline size_t
+sv_rfind_substr_(StringView hay, size_t pos, StringView needle)
 {
-    StringView needle_sv = sv_from_cstr(needle);
-    return sv_rfind_substr_from(hay, pos, needle_sv);
+    if (needle.length == 1) {
+        const void *p = sv_memrchr_(hay.begin, (unsigned char)needle.begin[0], pos + 1);
+        return p ? (size_t)((const char *)p - hay.begin) : SV_NPOS;
+    }
+
+    size_t end = pos + 1;
+#if SV_HAS_SSE2
+    size_t found;
+#endif
+#if SV_HAS_AVX512
+    if ((found = sv_rfind_substr_avx512_(hay, &end, needle)) != SV_NPOS) return found;
+#endif
+#if SV_HAS_AVX2
+    if ((found = sv_rfind_substr_avx2_(hay, &end, needle)) != SV_NPOS) return found;
+#endif
+#if SV_HAS_SSE2
+    if ((found = sv_rfind_substr_sse2_(hay, &end, needle)) != SV_NPOS) return found;
+#endif
+    if (end == 0) return SV_NPOS;
+    return sv_rfind_substr_scalar_(hay, end - 1, needle);
 }
 
-SVDEF bool
-sv_contains(StringView hay, StringView needle) SV_NOEXCEPT
+
+
+SVDEF StringView
+sv_empty(SV_NO_PARAMS) SV_NOEXCEPT
 {
-    return sv_find_substr(hay, needle) != SV_NPOS;
+
+#ifndef __cplusplus
+    StringView result = {0};
+#else
+    StringView result = {};
+#endif
+
+    return result;
 }
 
-SVDEF bool
-sv_contains_cstr(StringView hay, const char *needle) SV_NOEXCEPT
+SVDEF StringView
+sv_from_cstr(const char *cstr) SV_NOEXCEPT
 {
-    return sv_find_substr_cstr(hay, needle) != SV_NPOS;
+    if (!cstr) return sv_empty();
+
+    StringView sv = sv_empty();
+    sv.begin  = cstr;
+    sv.length = strlen(cstr);
+    return sv;
 }
 
 SVDEF StringView
-sv_trim_left(StringView sv) SV_NOEXCEPT
+sv_from_parts(const char *begin, size_t length) SV_NOEXCEPT
 {
-    size_t i = 0;
-    while (i < sv.length && isspace((unsigned char)sv.begin[i])) i += 1;
+    SV_ASSERT(begin != NULL || length == 0);
 
-    return sv_from_parts(sv.begin + i, sv.length - i);
+    StringView sv = sv_empty();
+    sv.begin  = begin;
+    sv.length = length;
+    return sv;
 }
 
-SVDEF StringView
-sv_trim_right(StringView sv) SV_NOEXCEPT
+SVDEF char
+sv_at(StringView sv, size_t i) SV_NOEXCEPT
 {
-    size_t i = 0;
-    while (i < sv.length && isspace((unsigned char)sv.begin[sv.length - i - 1])) i += 1;
+    SV_ASSERT(i < sv.length);
+    return sv.begin[i];
+}
 
-    return sv_from_parts(sv.begin, sv.length - i);
+SVDEF char
+sv_first(StringView sv) SV_NOEXCEPT
+{
+    SV_ASSERT(sv.length > 0);
+    return sv.begin[0];
 }
 
-SVDEF StringView
-sv_trim(StringView sv) SV_NOEXCEPT
+SVDEF char
+sv_last(StringView sv) SV_NOEXCEPT
 {
-    return sv_trim_right(sv_trim_left(sv));
+    SV_ASSERT(sv.length > 0);
+    return sv.begin[sv.length-1];
 }
 
 SVDEF StringView
-sv_take(StringView sv, size_t n) SV_NOEXCEPT
+sv_substr(StringView sv, size_t pos, size_t count) SV_NOEXCEPT
 {
-    SV_ASSERT(n <= sv.length);
-    return sv_substr(sv, 0, n);
+    SV_ASSERT(pos <= sv.length);
+    SV_ASSERT(count <= sv.length - pos);
+
+    StringView result = sv_empty();
+    result.begin = sv.begin + pos;
+    result.length = count;
+
+    return result;
 }
 
-SVDEF StringView
-sv_drop(StringView sv, size_t n) SV_NOEXCEPT
+SVDEF bool
+sv_eq(StringView sv1, StringView sv2) SV_NOEXCEPT
 {
-    SV_ASSERT(n <= sv.length);
-    return sv_substr(sv, n, sv.length-n);
+    if (sv1.length != sv2.length) return false;
+    if (sv1.length == 0) return true;
+
+    return memcmp(sv1.begin, sv2.begin, sv1.length) == 0;
 }
 
-SVDEF StringView
-sv_take_last(StringView sv, size_t n) SV_NOEXCEPT
+SVDEF bool
+sv_eq_cstr(StringView sv, const char *cstr) SV_NOEXCEPT
 {
-    SV_ASSERT(n <= sv.length);
-    return sv_substr(sv, sv.length-n, n);
+    if (!cstr) return false;
+
+    size_t length = strlen(cstr);
+    return sv_eq_cstr_n(sv, cstr, length);
+}
+
+SVDEF bool
+sv_eq_cstr_n(StringView sv, const char *cstr, size_t length) SV_NOEXCEPT
+{
+    if (!cstr) return false;
+
+    if (sv.length != length) return false;
+    return sv.length == 0 || memcmp(sv.begin, cstr, length) == 0;
+}
+
+SVDEF bool
+sv_is_empty(StringView sv) SV_NOEXCEPT
+{
+    return sv.length == 0;
+}
+
+SVDEF bool
+sv_starts_with(StringView sv, StringView prefix) SV_NOEXCEPT
+{
+    if (prefix.length > sv.length) return 0;
+
+    return memcmp(sv.begin, prefix.begin, prefix.length) == 0;
+}
+
+SVDEF bool
+sv_ends_with(StringView sv, StringView suffix) SV_NOEXCEPT
+{
+    if (suffix.length > sv.length) return 0;
+
+    const size_t offset = sv.length - suffix.length;
+    return memcmp(sv.begin + offset, suffix.begin, suffix.length) == 0;
+}
+
+SVDEF size_t
+sv_find_char(StringView sv, char c) SV_NOEXCEPT
+{
+    if (sv.length == 0) return SV_NPOS;
+
+    const void *p = memchr(sv.begin, (unsigned char)c, sv.length);
+    return p ? (size_t)((const char *)p - sv.begin) : SV_NPOS;
+}
+
+SVDEF size_t
+sv_rfind_char(StringView sv, char c) SV_NOEXCEPT
+{
+    if (sv.length == 0) return SV_NPOS;
+
+    const void *p = sv_memrchr_(sv.begin, (unsigned char)c, sv.length);
+    return p ? (size_t)((const char *)p - sv.begin) : SV_NPOS;
+}
+
+SVDEF size_t
+sv_find_char_from(StringView sv, size_t pos, char c) SV_NOEXCEPT
+{
+    if (sv.length == 0)  return SV_NPOS;
+    if (pos > sv.length) pos = sv.length;
+
+    const void *p = memchr(sv.begin + pos, (unsigned char)c, sv.length - pos);
+    return p ? (size_t)((const char *)p - sv.begin) : SV_NPOS;
+}
+
+SVDEF size_t
+sv_rfind_char_from(StringView sv, size_t pos, char c) SV_NOEXCEPT
+{
+    if (sv.length == 0)   return SV_NPOS;
+    if (pos >= sv.length) pos = sv.length-1;
+
+    const void *p = sv_memrchr_(sv.begin, (unsigned char)c, pos+1);
+    return p ? (size_t)((const char *)p - sv.begin) : SV_NPOS;
+}
+
+SVDEF size_t
+sv_find_char2(StringView sv, char c1, char c2) SV_NOEXCEPT
+{
+    return sv_find_char3_from(sv, 0, c1, c2, c2);
+}
+
+SVDEF size_t
+sv_find_char3(StringView sv, char c1, char c2, char c3) SV_NOEXCEPT
+{
+    return sv_find_char3_from(sv, 0, c1, c2, c3);
+}
+
+SVDEF size_t
+sv_rfind_char2(StringView sv, char c1, char c2) SV_NOEXCEPT
+{
+    return sv_rfind_char3_from(sv, SV_NPOS, c1, c2, c2);
+}
+
+SVDEF size_t
+sv_rfind_char3(StringView sv, char c1, char c2, char c3) SV_NOEXCEPT
+{
+    return sv_rfind_char3_from(sv, SV_NPOS, c1, c2, c3);
+}
+
+SVDEF size_t
+sv_find_char2_from(StringView sv, size_t pos, char c1, char c2) SV_NOEXCEPT
+{
+    return sv_find_char3_from(sv, pos, c1, c2, c2);
+}
+
+SVDEF size_t
+sv_find_char3_from(StringView sv, size_t pos, char c1, char c2, char c3) SV_NOEXCEPT
+{
+    if (sv.length == 0)  return SV_NPOS;
+    if (pos > sv.length) pos = sv.length;
+
+    const char *p = sv_memchr3_(sv.begin + pos, sv.length - pos,
+                                (unsigned char)c1, (unsigned char)c2, (unsigned char)c3);
+    return p ? (size_t)(p - sv.begin) : SV_NPOS;
+}
+
+SVDEF size_t
+sv_rfind_char2_from(StringView sv, size_t pos, char c1, char c2) SV_NOEXCEPT
+{
+    return sv_rfind_char3_from(sv, pos, c1, c2, c2);
+}
+
+SVDEF size_t
+sv_rfind_char3_from(StringView sv, size_t pos, char c1, char c2, char c3) SV_NOEXCEPT
+{
+    if (sv.length == 0)   return SV_NPOS;
+    if (pos >= sv.length) pos = sv.length-1;
+
+    const char *p = sv_memrchr3_(sv.begin, pos+1,
+                                 (unsigned char)c1, (unsigned char)c2, (unsigned char)c3);
+    return p ? (size_t)(p - sv.begin) : SV_NPOS;
+}
+
+SVDEF size_t
+sv_find_substr(StringView hay, StringView needle) SV_NOEXCEPT
+{
+    if (needle.length == 0)         return 0;
+    if (needle.length > hay.length) return SV_NPOS;
+
+    return sv_find_substr_(hay, 0, needle);
+}
+
+
+SVDEF size_t
+sv_rfind_substr(StringView hay, StringView needle) SV_NOEXCEPT
+{
+    if (needle.length == 0)         return hay.length;
+    if (needle.length > hay.length) return SV_NPOS;
+
+    return sv_rfind_substr_(hay, hay.length - needle.length, needle);
+}
+
+SVDEF size_t
+sv_find_substr_from(StringView hay, size_t pos, StringView needle) SV_NOEXCEPT
+{
+    if (pos > hay.length)                 pos = hay.length;
+    if (needle.length == 0)               return pos;
+    if (needle.length > hay.length - pos) return SV_NPOS;
+
+    return sv_find_substr_(hay, pos, needle);
+}
+
+SVDEF size_t
+sv_rfind_substr_from(StringView hay, size_t pos, StringView needle) SV_NOEXCEPT
+{
+    if (pos > hay.length)           pos = hay.length;
+    if (needle.length == 0)         return pos;
+    if (needle.length > hay.length) return SV_NPOS;
+    if (pos + 1 < needle.length)    return SV_NPOS;
+
+    size_t last_start = hay.length - needle.length;
+    if (pos > last_start) pos = last_start;
+
+    return sv_rfind_substr_(hay, pos, needle);
+}
+
+SVDEF size_t
+sv_find_substr_cstr(StringView hay, const char *needle) SV_NOEXCEPT
+{
+    StringView needle_sv = sv_from_cstr(needle);
+    return sv_find_substr(hay, needle_sv);
+}
+
+
+SVDEF size_t
+sv_rfind_substr_cstr(StringView hay, const char *needle) SV_NOEXCEPT
+{
+    StringView needle_sv = sv_from_cstr(needle);
+    return sv_rfind_substr(hay, needle_sv);
+}
+
+SVDEF size_t
+sv_find_substr_cstr_from(StringView hay, size_t pos, const char *needle) SV_NOEXCEPT
+{
+    StringView needle_sv = sv_from_cstr(needle);
+    return sv_find_substr_from(hay, pos, needle_sv);
+}
+
+SVDEF size_t
+sv_rfind_substr_cstr_from(StringView hay, size_t pos, const char *needle) SV_NOEXCEPT
+{
+    StringView needle_sv = sv_from_cstr(needle);
+    return sv_rfind_substr_from(hay, pos, needle_sv);
+}
+
+SVDEF bool
+sv_contains(StringView hay, StringView needle) SV_NOEXCEPT
+{
+    return sv_find_substr(hay, needle) != SV_NPOS;
+}
+
+SVDEF bool
+sv_contains_cstr(StringView hay, const char *needle) SV_NOEXCEPT
+{
+    return sv_find_substr_cstr(hay, needle) != SV_NPOS;
+}
+
+// Two-Way string matching (Crochemore & Perrin, "Two-way string-matching", 1991).
+// Both helpers read their inputs through a stride of +1 or -1, so the same code
+// serves forward search and reverse search (reading needle and haystack backwards
+// from their last byte).
+#define SV_AT_(p, i) ((p)[(ptrdiff_t)(i) * dir])
+
+// Returns the start of the right half of a critical factorization of x[0..m),
+// and the period of that half in *period.
+static inline size_t
+sv_critical_factorization_(const unsigned char *x, ptrdiff_t dir, size_t m, size_t *period)
+{
+    if (m < 3) {
+        *period = 1;
+        return m - 1;
+    }
+
+    // Maximal suffix for '<' and for '>'. Indices start at SIZE_MAX so that
+    // max_suffix + k wraps around to k - 1 on the first iteration.
+    size_t max_suffix = SIZE_MAX, j = 0, k = 1, p = 1;
+    while (j + k < m) {
+        const unsigned char a = SV_AT_(x, j + k);
+        const unsigned char b = SV_AT_(x, max_suffix + k);
+        if (a < b)       { j += k; k = 1; p = j - max_suffix; }
+        else if (a == b) { if (k != p) k += 1; else { j += p; k = 1; } }
+        else             { max_suffix = j++; k = p = 1; }
+    }
+    const size_t period_lt = p;
+
+    size_t max_suffix_rev = SIZE_MAX;
+    j = 0; k = 1; p = 1;
+    while (j + k < m) {
+        const unsigned char a = SV_AT_(x, j + k);
+        const unsigned char b = SV_AT_(x, max_suffix_rev + k);
+        if (b < a)       { j += k; k = 1; p = j - max_suffix_rev; }
+        else if (a == b) { if (k != p) k += 1; else { j += p; k = 1; } }
+        else             { max_suffix_rev = j++; k = p = 1; }
+    }
+
+    if (max_suffix_rev + 1 < max_suffix + 1) {
+        *period = period_lt;
+        return max_suffix + 1;
+    }
+    *period = p;
+    return max_suffix_rev + 1;
+}
+
+static inline void
+sv_two_way_prepare_(const unsigned char *x, ptrdiff_t dir, size_t m,
+                    size_t *out_suffix, size_t *out_period, bool *out_periodic)
+{
+    size_t period;
+    const size_t suffix = sv_critical_factorization_(x, dir, m, &period);
+
+    // The needle is periodic if its left half repeats at distance 'period'
+    bool periodic = period + suffix <= m;
+    for (size_t i = 0; periodic && i < suffix; ++i) {
+        periodic = SV_AT_(x, i) == SV_AT_(x, i + period);
+    }
+
+    *out_suffix   = suffix;
+    *out_period   = periodic ? period : ((suffix > m - suffix ? suffix : m - suffix) + 1);
+    *out_periodic = periodic;
+}
+
+// First match of x[0..m) in h[0..n), or SV_NPOS. Requires 0 < m.
+static inline size_t
+sv_two_way_search_(const unsigned char *h, const unsigned char *x, ptrdiff_t dir,
+                   size_t n, size_t m, size_t suffix, size_t period, bool periodic)
+{
+    size_t j = 0;
+    if (periodic) {
+        // A mismatch in the left half can only advance by the period, so remember
+        // how much of the right half is already known to match.
+        size_t memory = 0;
+        while (m <= n - j) {
+            size_t i = suffix > memory ? suffix : memory;
+            while (i < m && SV_AT_(x, i) == SV_AT_(h, i + j)) i += 1;
+            if (i >= m) {
+                i = suffix - 1;
+                while (memory < i + 1 && SV_AT_(x, i) == SV_AT_(h, i + j)) i -= 1;
+                if (i + 1 < memory + 1) return j;
+                j += period;
+                memory = m - period;
+            } else {
+                j += i - suffix + 1;
+                memory = 0;
+            }
+        }
+    } else {
+        while (m <= n - j) {
+            size_t i = suffix;
+            while (i < m && SV_AT_(x, i) == SV_AT_(h, i + j)) i += 1;
+            if (i >= m) {
+                i = suffix - 1;
+                while (i != SIZE_MAX && SV_AT_(x, i) == SV_AT_(h, i + j)) i -= 1;
+                if (i == SIZE_MAX) return j;
+                j += period;
+            } else {
+                j += i - suffix + 1;
+            }
+        }
+    }
+    return SV_NPOS;
+}
+
+#undef SV_AT_
+
+SVDEF void
+sv_searcher_init(SvSearcher *searcher, StringView needle) SV_NOEXCEPT
+{
+    SV_ASSERT(searcher != NULL);
+
+    memset(searcher, 0, sizeof *searcher);
+    searcher->needle = needle;
+
+    if (needle.length == 0) {
+        searcher->kind = SV_SEARCHER_EMPTY;
+    } else if (needle.length == 1) {
+        searcher->kind = SV_SEARCHER_BYTE;
+    } else if (needle.length <= SV_SEARCHER_SHORT_MAX) {
+        searcher->kind = SV_SEARCHER_SHORT;
+    } else {
+        const unsigned char *x = (const unsigned char *)needle.begin;
+        const size_t         m = needle.length;
+        searcher->kind = SV_SEARCHER_TWO_WAY;
+        sv_two_way_prepare_(x, 1, m,
+                            &searcher->fwd_suffix, &searcher->fwd_period, &searcher->fwd_periodic);
+        sv_two_way_prepare_(x + m - 1, -1, m,
+                            &searcher->rev_suffix, &searcher->rev_period, &searcher->rev_periodic);
+    }
+}
+
+SVDEF size_t
+sv_searcher_find(const SvSearcher *searcher, StringView hay) SV_NOEXCEPT
+{
+    return sv_searcher_find_from(searcher, hay, 0);
+}
+
+SVDEF size_t
+sv_searcher_find_from(const SvSearcher *searcher, StringView hay, size_t pos) SV_NOEXCEPT
+{
+    SV_ASSERT(searcher != NULL);
+
+    const StringView needle = searcher->needle;
+    if (pos > hay.length)                 pos = hay.length;
+    if (needle.length == 0)               return pos;
+    if (needle.length > hay.length - pos) return SV_NPOS;
+
+    if (searcher->kind != SV_SEARCHER_TWO_WAY) return sv_find_substr_(hay, pos, needle);
+
+    const size_t found = sv_two_way_search_((const unsigned char *)hay.begin + pos,
+                                            (const unsigned char *)needle.begin, 1,
+                                            hay.length - pos, needle.length,
+                                            searcher->fwd_suffix, searcher->fwd_period,
+                                            searcher->fwd_periodic);
+    return found == SV_NPOS ? SV_NPOS : pos + found;
+}
+
+SVDEF size_t
+sv_searcher_rfind(const SvSearcher *searcher, StringView hay) SV_NOEXCEPT
+{
+    SV_ASSERT(searcher != NULL);
+
+    const StringView needle = searcher->needle;
+    if (needle.length == 0)         return hay.length;
+    if (needle.length > hay.length) return SV_NPOS;
+
+    return sv_searcher_rfind_from(searcher, hay, hay.length - needle.length);
+}
+
+SVDEF size_t
+sv_searcher_rfind_from(const SvSearcher *searcher, StringView hay, size_t pos) SV_NOEXCEPT
+{
+    SV_ASSERT(searcher != NULL);
+
+    const StringView needle = searcher->needle;
+    if (pos > hay.length)           pos = hay.length;
+    if (needle.length == 0)         return pos;
+    if (needle.length > hay.length) return SV_NPOS;
+    if (pos + 1 < needle.length)    return SV_NPOS;
+
+    size_t last_start = hay.length - needle.length;
+    if (pos > last_start) pos = last_start;
+
+    if (searcher->kind != SV_SEARCHER_TWO_WAY) return sv_rfind_substr_(hay, pos, needle);
+
+    // Search the reversed needle in the reversed window hay[0, pos + m). A match
+    // j positions from the window's end starts at pos - j in the original.
+    const size_t m     = needle.length;
+    const size_t found = sv_two_way_search_((const unsigned char *)hay.begin + pos + m - 1,
+                                            (const unsigned char *)needle.begin + m - 1, -1,
+                                            pos + m, m,
+                                            searcher->rev_suffix, searcher->rev_period,
+                                            searcher->rev_periodic);
+    return found == SV_NPOS ? SV_NPOS : pos - found;
+}
+
+static inline void *
+sv_alloc_(const SvAllocator *allocator, size_t size)
+{
+    return allocator->alloc ? allocator->alloc(allocator->ctx, size) : SV_MALLOC(size);
+}
+
+static inline void
+sv_dealloc_(const SvAllocator *allocator, void *ptr, size_t size)
+{
+    if (!ptr) return;
+    if (allocator->free) allocator->free(allocator->ctx, ptr, size);
+    else                 SV_FREE(ptr);
+}
+
+// Round n up to a multiple of 8 so sub-arrays of one allocation stay aligned
+static inline size_t
+sv_align8_(size_t n)
+{
+    return (n + 7u) & ~(size_t)7u;
+}
+
+// Teddy fingerprint test for one haystack offset: bucket bits of all patterns
+// whose first teddy_width bytes may match at h.
+static inline unsigned
+sv_teddy_candidates_(const SvMultiSearcher *ms, const unsigned char *h)
+{
+    unsigned bits = 0xffu;
+    for (size_t k = 0; k < ms->teddy_width; ++k) {
+        bits &= ms->teddy_lo[k][h[k] & 15u] & ms->teddy_hi[k][h[k] >> 4];
+    }
+    return bits;
+}
+
+// Verify the patterns of the buckets in 'bits' at hay[i]. Returns the lowest
+// matching pattern index, or SV_NPOS.
+static inline size_t
+sv_teddy_verify_(const SvMultiSearcher *ms, StringView hay, size_t i, unsigned bits)
+{
+    size_t best = SV_NPOS;
+    while (bits) {
+        const unsigned bucket = sv_ctz32_(bits);
+        bits &= bits - 1;
+        for (uint32_t k = ms->teddy_bucket_start[bucket]; k < ms->teddy_bucket_start[bucket + 1]; ++k) {
+            const size_t     idx = ms->teddy_bucket_patterns[k];
+            const StringView pat = ms->patterns[idx];
+            if (idx < best && pat.length <= hay.length - i &&
+                memcmp(hay.begin + i, pat.begin, pat.length) == 0) {
+                best = idx;
+            }
+        }
+    }
+    return best;
+}
+
+#if SV_HAS_SSSE3
+// Teddy: pshufb looks up the bucket bits for the low and high nibble of 16 (32)
+// haystack bytes at once, for each of the first teddy_width pattern bytes.
+// Lanes with any bit left are candidates and get verified.
+static inline size_t
+sv_teddy_find_(const SvMultiSearcher *ms, StringView hay, size_t pos, size_t *out_pattern)
+{
+    const unsigned char *h     = (const unsigned char *)hay.begin;
+    const size_t         width = ms->teddy_width;
+    size_t               i     = pos;
+
+#if SV_HAS_AVX2
+    {
+        const __m256i nibble = _mm256_set1_epi8(0x0f);
+        __m256i lo[3], hi[3];
+        for (size_t k = 0; k < width; ++k) {
+            lo[k] = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)ms->teddy_lo[k]));
+            hi[k] = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)ms->teddy_hi[k]));
+        }
+        for (; hay.length - i >= width - 1 + 32; i += 32) {
+            __m256i acc = _mm256_set1_epi8((char)0xff);
+            for (size_t k = 0; k < width; ++k) {
+                const __m256i v     = _mm256_loadu_si256((const __m256i *)(h + i + k));
+                const __m256i lo_nb = _mm256_and_si256(v, nibble);
+                const __m256i hi_nb = _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble);
+                acc = _mm256_and_si256(acc, _mm256_and_si256(_mm256_shuffle_epi8(lo[k], lo_nb),
+                                                             _mm256_shuffle_epi8(hi[k], hi_nb)));
+            }
+            uint32_t mask = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(acc, _mm256_setzero_si256()));
+            while (mask) {
+                const size_t at  = i + sv_ctz32_(mask);
+                const size_t idx = sv_teddy_verify_(ms, hay, at, sv_teddy_candidates_(ms, h + at));
+                if (idx != SV_NPOS) { *out_pattern = idx; return at; }
+                mask &= mask - 1;
+            }
+        }
+    }
+#endif
+
+    {
+        const __m128i nibble = _mm_set1_epi8(0x0f);
+        __m128i lo[3], hi[3];
+        for (size_t k = 0; k < width; ++k) {
+            lo[k] = _mm_loadu_si128((const __m128i *)ms->teddy_lo[k]);
+            hi[k] = _mm_loadu_si128((const __m128i *)ms->teddy_hi[k]);
+        }
+        for (; hay.length - i >= width - 1 + 16; i += 16) {
+            __m128i acc = _mm_set1_epi8((char)0xff);
+            for (size_t k = 0; k < width; ++k) {
+                const __m128i v     = _mm_loadu_si128((const __m128i *)(h + i + k));
+                const __m128i lo_nb = _mm_and_si128(v, nibble);
+                const __m128i hi_nb = _mm_and_si128(_mm_srli_epi16(v, 4), nibble);
+                acc = _mm_and_si128(acc, _mm_and_si128(_mm_shuffle_epi8(lo[k], lo_nb),
+                                                       _mm_shuffle_epi8(hi[k], hi_nb)));
+            }
+            uint32_t mask = 0xffffu & ~(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(acc, _mm_setzero_si128()));
+            while (mask) {
+                const size_t at  = i + sv_ctz32_(mask);
+                const size_t idx = sv_teddy_verify_(ms, hay, at, sv_teddy_candidates_(ms, h + at));
+                if (idx != SV_NPOS) { *out_pattern = idx; return at; }
+                mask &= mask - 1;
+            }
+        }
+    }
+
+    for (; hay.length - i >= width; ++i) {
+        const unsigned bits = sv_teddy_candidates_(ms, h + i);
+        if (!bits) continue;
+        const size_t idx = sv_teddy_verify_(ms, hay, i, bits);
+        if (idx != SV_NPOS) { *out_pattern = idx; return i; }
+    }
+    return SV_NPOS;
+}
+#endif
+
+static inline size_t
+sv_aho_corasick_find_(const SvMultiSearcher *ms, StringView hay, size_t pos, size_t *out_pattern)
+{
+    const unsigned char *h     = (const unsigned char *)hay.begin;
+    const uint32_t      *next  = ms->ac_next;
+    const uint32_t      *out   = ms->ac_out;
+    const size_t         nc    = ms->class_count;
+    size_t               best  = SV_NPOS;
+    size_t               index = SV_NPOS;
+    uint32_t             state = 0;
+
+    for (size_t i = pos; i < hay.length; ++i) {
+        // No match ending from here on can start at or before the best one
+        if (best != SV_NPOS && i - best >= ms->max_length) break;
+
+        state = next[(size_t)state * nc + ms->byte_class[h[i]]];
+        if (out[state]) {
+            // out[] holds the longest pattern ending here, i.e. the leftmost start
+            const size_t idx   = out[state] - 1u;
+            const size_t start = i + 1 - ms->patterns[idx].length;
+            if (start < best || (start == best && idx < index)) {
+                best  = start;
+                index = idx;
+            }
+        }
+    }
+
+    if (best != SV_NPOS) *out_pattern = index;
+    return best;
+}
+
+// Builds the Aho-Corasick DFA into memory laid out by sv_multi_searcher_init().
+static inline void
+sv_aho_corasick_build_(SvMultiSearcher *ms, uint32_t *next, uint32_t *out, uint32_t *fail, uint32_t *queue)
+{
+    const size_t nc          = ms->class_count;
+    uint32_t     state_count = 1;
+
+    // Trie. 0 is the root, so a 0 transition from any other state means "none yet".
+    for (size_t idx = 0; idx < ms->count; ++idx) {
+        const StringView pat   = ms->patterns[idx];
+        uint32_t         state = 0;
+        for (size_t i = 0; i < pat.length; ++i) {
+            uint32_t *slot = &next[(size_t)state * nc + ms->byte_class[(unsigned char)pat.begin[i]]];
+            if (!*slot) *slot = state_count++;
+            state = *slot;
+        }
+        if (pat.length && !out[state]) out[state] = (uint32_t)idx + 1u;
+    }
+
+    // Breadth-first: failure links, inherited outputs, and missing transitions
+    // filled in from the failure state, which turns the trie into a DFA.
+    size_t head = 0, tail = 0;
+    for (size_t c = 0; c < nc; ++c) {
+        const uint32_t child = next[c];
+        if (child) { fail[child] = 0; queue[tail++] = child; }
+    }
+    while (head < tail) {
+        const uint32_t state = queue[head++];
+        if (!out[state]) out[state] = out[fail[state]];
+        for (size_t c = 0; c < nc; ++c) {
+            uint32_t      *slot     = &next[(size_t)state * nc + c];
+            const uint32_t fallback = next[(size_t)fail[state] * nc + c];
+            if (*slot) {
+                fail[*slot]    = fallback;
+                queue[tail++]  = *slot;
+            } else {
+                *slot = fallback;
+            }
+        }
+    }
+}
+
+SVDEF bool
+sv_multi_searcher_init(SvMultiSearcher   *searcher,
+                       const StringView  *patterns,
+                       size_t             count,
+                       const SvAllocator *allocator) SV_NOEXCEPT
+{
+    SV_ASSERT(searcher != NULL);
+    SV_ASSERT(patterns != NULL || count == 0);
+
+    memset(searcher, 0, sizeof *searcher);
+    if (allocator) searcher->allocator = *allocator;
+    searcher->count       = count;
+    searcher->empty_index = SV_NPOS;
+
+    size_t total_length = 0;
+    size_t min_length   = SIZE_MAX;
+    for (size_t i = 0; i < count; ++i) {
+        const size_t len = patterns[i].length;
+        if (len == 0 && searcher->empty_index == SV_NPOS) searcher->empty_index = i;
+        if (len > searcher->max_length) searcher->max_length = len;
+        if (len && len < min_length) min_length = len;
+        if (len > (size_t)UINT32_MAX - 1u - total_length) return false;
+        total_length += len;
+    }
+
+    // Byte classes: every byte used by a pattern gets its own class, all others share class 0
+    searcher->class_count = 1;
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t k = 0; k < patterns[i].length; ++k) {
+            const unsigned char c = (unsigned char)patterns[i].begin[k];
+            if (!searcher->byte_class[c]) searcher->byte_class[c] = (unsigned char)searcher->class_count++;
+        }
+    }
+
+    bool use_teddy = false;
+#if SV_HAS_SSSE3
+    use_teddy = count <= SV_MULTI_TEDDY_MAX && min_length != SIZE_MAX;
+#endif
+
+    const size_t states      = total_length + 1;
+    const size_t nc          = searcher->class_count;
+    const size_t patterns_sz = sv_align8_(count * sizeof(StringView));
+    size_t       size        = patterns_sz;
+    if (use_teddy) {
+        size += sv_align8_(9 * sizeof(uint32_t)) + sv_align8_(count * sizeof(uint32_t));
+    } else {
+        if (states > SIZE_MAX / sizeof(uint32_t) / (nc + 4)) return false;
+        size += sv_align8_(states * nc * sizeof(uint32_t))  // next
+              + sv_align8_(states * sizeof(uint32_t))       // out
+              + 2 * sv_align8_(states * sizeof(uint32_t));  // fail, queue (build only)
+    }
+
+    unsigned char *mem = (unsigned char *)sv_alloc_(&searcher->allocator, size);
+    if (!mem) return false;
+    memset(mem, 0, size);
+    searcher->memory      = mem;
+    searcher->memory_size = size;
+
+    StringView *copy = (StringView *)(void *)mem;
+    for (size_t i = 0; i < count; ++i) copy[i] = patterns[i];
+    searcher->patterns = copy;
+    mem += patterns_sz;
+
+    if (use_teddy) {
+        searcher->kind        = SV_MULTI_SEARCHER_TEDDY;
+        searcher->teddy_width = min_length < 3 ? min_length : 3;
+
+        uint32_t *bucket_start    = (uint32_t *)(void *)mem;
+        uint32_t *bucket_patterns = (uint32_t *)(void *)(mem + sv_align8_(9 * sizeof(uint32_t)));
+
+        // Patterns are spread round-robin over the 8 buckets (bits of a mask byte)
+        for (size_t i = 0; i < count; ++i) {
+            if (patterns[i].length) bucket_start[i % 8 + 1] += 1;
+        }
+        for (size_t b = 0; b < 8; ++b) bucket_start[b + 1] += bucket_start[b];
+
+        uint32_t fill[8];
+        memcpy(fill, bucket_start, sizeof fill);
+        for (size_t i = 0; i < count; ++i) {
+            if (!patterns[i].length) continue;
+            const unsigned bucket = (unsigned)(i % 8);
+            bucket_patterns[fill[bucket]++] = (uint32_t)i;
+            for (size_t k = 0; k < searcher->teddy_width; ++k) {
+                const unsigned char c = (unsigned char)patterns[i].begin[k];
+                searcher->teddy_lo[k][c & 15u] |= (unsigned char)(1u << bucket);
+                searcher->teddy_hi[k][c >> 4]  |= (unsigned char)(1u << bucket);
+            }
+        }
+        searcher->teddy_bucket_start    = bucket_start;
+        searcher->teddy_bucket_patterns = bucket_patterns;
+    } else {
+        searcher->kind = SV_MULTI_SEARCHER_AHO_CORASICK;
+
+        uint32_t *next  = (uint32_t *)(void *)mem;
+        uint32_t *out   = (uint32_t *)(void *)(mem + sv_align8_(states * nc * sizeof(uint32_t)));
+        uint32_t *fail  = (uint32_t *)(void *)((unsigned char *)out  + sv_align8_(states * sizeof(uint32_t)));
+        uint32_t *queue = (uint32_t *)(void *)((unsigned char *)fail + sv_align8_(states * sizeof(uint32_t)));
+        sv_aho_corasick_build_(searcher, next, out, fail, queue);
+        searcher->ac_next = next;
+        searcher->ac_out  = out;
+    }
+    return true;
+}
+
+SVDEF void
+sv_multi_searcher_free(SvMultiSearcher *searcher) SV_NOEXCEPT
+{
+    if (!searcher) return;
+    sv_dealloc_(&searcher->allocator, searcher->memory, searcher->memory_size);
+    memset(searcher, 0, sizeof *searcher);
+}
+
+SVDEF size_t
+sv_multi_searcher_find(const SvMultiSearcher *searcher, StringView hay, size_t *out_pattern) SV_NOEXCEPT
+{
+    return sv_multi_searcher_find_from(searcher, hay, 0, out_pattern);
+}
+
+SVDEF size_t
+sv_multi_searcher_find_from(const SvMultiSearcher *searcher,
+                            StringView             hay,
+                            size_t                 pos,
+                            size_t                *out_pattern) SV_NOEXCEPT
+{
+    SV_ASSERT(searcher != NULL);
+
+    size_t pattern = SV_NPOS;
+    if (pos > hay.length) pos = hay.length;
+
+    // An empty pattern matches right at pos; only a lower-indexed pattern matching there beats it
+    if (searcher->empty_index != SV_NPOS) {
+        pattern = searcher->empty_index;
+        for (size_t i = 0; i < searcher->empty_index; ++i) {
+            const StringView pat = searcher->patterns[i];
+            if (pat.length <= hay.length - pos && memcmp(hay.begin + pos, pat.begin, pat.length) == 0) {
+                pattern = i;
+                break;
+            }
+        }
+        if (out_pattern) *out_pattern = pattern;
+        return pos;
+    }
+    if (searcher->count == 0) return SV_NPOS;
+
+#if SV_HAS_SSSE3
+    const size_t found = searcher->kind == SV_MULTI_SEARCHER_TEDDY
+                       ? sv_teddy_find_(searcher, hay, pos, &pattern)
+                       : sv_aho_corasick_find_(searcher, hay, pos, &pattern);
+#else
+    const size_t found = sv_aho_corasick_find_(searcher, hay, pos, &pattern);
+#endif
+
+    if (found != SV_NPOS && out_pattern) *out_pattern = pattern;
+    return found;
+}
+
+static inline bool
+sv_byteset_has_(const SvByteSet *set, unsigned char c)
+{
+    return (set->bits[c >> 6] >> (c & 63u)) & 1u;
+}
+
+// Membership classifier: for each byte x, pshufb with (x & 0x8f) picks the
+// low-nibble entry of table 0 (zero if x >= 0x80), the same index with bit 7
+// flipped picks table 1, and a third pshufb maps the high nibble to its bit.
+#if SV_HAS_SSSE3
+// Bit (high nibble & 7) for each high nibble
+static const unsigned char sv_byteset_bitpos_[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+#endif
+
+#if SV_HAS_AVX512
+// Four copies of a 16-byte table. Built in memory rather than with
+// _mm512_broadcast_i32x4, which trips -Wuninitialized inside GCC's own headers.
+static inline __m512i
+sv_broadcast16_x4_(const unsigned char *table)
+{
+    unsigned char tmp[64];
+    for (size_t k = 0; k < 4; ++k) memcpy(tmp + 16 * k, table, 16);
+    return _mm512_loadu_si512((const void *)tmp);
+}
+
+static inline uint64_t
+sv_byteset_classify64_(__m512i v, __m512i tab0, __m512i tab1, __m512i bitpos)
+{
+    const __m512i idx  = _mm512_and_si512(v, _mm512_set1_epi8((char)0x8f));
+    const __m512i t    = _mm512_or_si512(_mm512_shuffle_epi8(tab0, idx),
+                                         _mm512_shuffle_epi8(tab1, _mm512_xor_si512(idx, _mm512_set1_epi8((char)0x80))));
+    const __m512i hi   = _mm512_and_si512(_mm512_srli_epi16(v, 4), _mm512_set1_epi8(0x0f));
+    return (uint64_t)_mm512_test_epi8_mask(t, _mm512_shuffle_epi8(bitpos, hi));
+}
+#endif
+
+#if SV_HAS_AVX2
+static inline uint32_t
+sv_byteset_classify32_(__m256i v, __m256i tab0, __m256i tab1, __m256i bitpos)
+{
+    const __m256i idx  = _mm256_and_si256(v, _mm256_set1_epi8((char)0x8f));
+    const __m256i t    = _mm256_or_si256(_mm256_shuffle_epi8(tab0, idx),
+                                         _mm256_shuffle_epi8(tab1, _mm256_xor_si256(idx, _mm256_set1_epi8((char)0x80))));
+    const __m256i hi   = _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0f));
+    const __m256i bits = _mm256_shuffle_epi8(bitpos, hi);
+    return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(t, bits), bits));
+}
+#endif
+
+#if SV_HAS_SSSE3
+static inline uint32_t
+sv_byteset_classify16_(__m128i v, __m128i tab0, __m128i tab1, __m128i bitpos)
+{
+    const __m128i idx  = _mm_and_si128(v, _mm_set1_epi8((char)0x8f));
+    const __m128i t    = _mm_or_si128(_mm_shuffle_epi8(tab0, idx),
+                                      _mm_shuffle_epi8(tab1, _mm_xor_si128(idx, _mm_set1_epi8((char)0x80))));
+    const __m128i hi   = _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0f));
+    const __m128i bits = _mm_shuffle_epi8(bitpos, hi);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(t, bits), bits));
+}
+#endif
+
+// Index of the first byte in p[0..n) whose membership equals 'member', or SV_NPOS
+static inline size_t
+sv_byteset_scan_(const SvByteSet *set, const unsigned char *p, size_t n, bool member)
+{
+    size_t i = 0;
+
+#if SV_HAS_SSSE3
+    const __m128i tab0   = _mm_loadu_si128((const __m128i *)set->nibble[0]);
+    const __m128i tab1   = _mm_loadu_si128((const __m128i *)set->nibble[1]);
+    const __m128i bitpos = _mm_loadu_si128((const __m128i *)sv_byteset_bitpos_);
+#endif
+#if SV_HAS_AVX512
+    {
+        const __m512i tab0_512   = sv_broadcast16_x4_(set->nibble[0]);
+        const __m512i tab1_512   = sv_broadcast16_x4_(set->nibble[1]);
+        const __m512i bitpos_512 = sv_broadcast16_x4_(sv_byteset_bitpos_);
+        const uint64_t flip      = member ? 0 : ~(uint64_t)0;
+        for (; n - i >= 64; i += 64) {
+            const __m512i v    = _mm512_loadu_si512((const void *)(p + i));
+            const uint64_t mask = sv_byteset_classify64_(v, tab0_512, tab1_512, bitpos_512) ^ flip;
+            if (mask) return i + sv_ctz64_(mask);
+        }
+    }
+#endif
+#if SV_HAS_AVX2
+    {
+        const __m256i tab0_256   = _mm256_broadcastsi128_si256(tab0);
+        const __m256i tab1_256   = _mm256_broadcastsi128_si256(tab1);
+        const __m256i bitpos_256 = _mm256_broadcastsi128_si256(bitpos);
+        const uint32_t flip      = member ? 0 : ~(uint32_t)0;
+        for (; n - i >= 32; i += 32) {
+            const __m256i v    = _mm256_loadu_si256((const __m256i *)(p + i));
+            const uint32_t mask = sv_byteset_classify32_(v, tab0_256, tab1_256, bitpos_256) ^ flip;
+            if (mask) return i + sv_ctz32_(mask);
+        }
+    }
+#endif
+#if SV_HAS_SSSE3
+    {
+        const uint32_t flip = member ? 0 : 0xffffu;
+        for (; n - i >= 16; i += 16) {
+            const uint32_t mask = sv_byteset_classify16_(_mm_loadu_si128((const __m128i *)(p + i)), tab0, tab1, bitpos) ^ flip;
+            if (mask) return i + sv_ctz32_(mask);
+        }
+    }
+#endif
+
+    for (; i < n; ++i) {
+        if (sv_byteset_has_(set, p[i]) == member) return i;
+    }
+    return SV_NPOS;
+}
+
+// Index of the last byte in p[0..n) whose membership equals 'member', or SV_NPOS
+static inline size_t
+sv_byteset_rscan_(const SvByteSet *set, const unsigned char *p, size_t n, bool member)
+{
+#if SV_HAS_SSSE3
+    const __m128i tab0   = _mm_loadu_si128((const __m128i *)set->nibble[0]);
+    const __m128i tab1   = _mm_loadu_si128((const __m128i *)set->nibble[1]);
+    const __m128i bitpos = _mm_loadu_si128((const __m128i *)sv_byteset_bitpos_);
+#endif
+#if SV_HAS_AVX512
+    {
+        const __m512i tab0_512   = sv_broadcast16_x4_(set->nibble[0]);
+        const __m512i tab1_512   = sv_broadcast16_x4_(set->nibble[1]);
+        const __m512i bitpos_512 = sv_broadcast16_x4_(sv_byteset_bitpos_);
+        const uint64_t flip      = member ? 0 : ~(uint64_t)0;
+        for (; n >= 64; n -= 64) {
+            const __m512i v    = _mm512_loadu_si512((const void *)(p + n - 64));
+            const uint64_t mask = sv_byteset_classify64_(v, tab0_512, tab1_512, bitpos_512) ^ flip;
+            if (mask) return n - 64 + sv_msb64_(mask);
+        }
+    }
+#endif
+#if SV_HAS_AVX2
+    {
+        const __m256i tab0_256   = _mm256_broadcastsi128_si256(tab0);
+        const __m256i tab1_256   = _mm256_broadcastsi128_si256(tab1);
+        const __m256i bitpos_256 = _mm256_broadcastsi128_si256(bitpos);
+        const uint32_t flip      = member ? 0 : ~(uint32_t)0;
+        for (; n >= 32; n -= 32) {
+            const __m256i v    = _mm256_loadu_si256((const __m256i *)(p + n - 32));
+            const uint32_t mask = sv_byteset_classify32_(v, tab0_256, tab1_256, bitpos_256) ^ flip;
+            if (mask) return n - 32 + sv_msb32_(mask);
+        }
+    }
+#endif
+#if SV_HAS_SSSE3
+    {
+        const uint32_t flip = member ? 0 : 0xffffu;
+        for (; n >= 16; n -= 16) {
+            const uint32_t mask = sv_byteset_classify16_(_mm_loadu_si128((const __m128i *)(p + n - 16)), tab0, tab1, bitpos) ^ flip;
+            if (mask) return n - 16 + sv_msb32_(mask);
+        }
+    }
+#endif
+
+    while (n--) {
+        if (sv_byteset_has_(set, p[n]) == member) return n;
+    }
+    return SV_NPOS;
+}
+
+SVDEF void
+sv_byteset_init(SvByteSet *set, StringView chars) SV_NOEXCEPT
+{
+    SV_ASSERT(set != NULL);
+
+    memset(set, 0, sizeof *set);
+    for (size_t i = 0; i < chars.length; ++i) sv_byteset_add(set, chars.begin[i]);
+}
+
+SVDEF void
+sv_byteset_add(SvByteSet *set, char c) SV_NOEXCEPT
+{
+    SV_ASSERT(set != NULL);
+
+    const unsigned char uc = (unsigned char)c;
+    set->bits[uc >> 6]             |= (uint64_t)1 << (uc & 63u);
+    set->nibble[uc >> 7][uc & 15u] |= (unsigned char)(1u << ((uc >> 4) & 7u));
+}
+
+SVDEF bool
+sv_byteset_contains(const SvByteSet *set, char c) SV_NOEXCEPT
+{
+    SV_ASSERT(set != NULL);
+    return sv_byteset_has_(set, (unsigned char)c);
+}
+
+SVDEF size_t
+sv_find_first_of(StringView sv, const SvByteSet *set) SV_NOEXCEPT
+{
+    return sv_find_first_of_from(sv, 0, set);
+}
+
+SVDEF size_t
+sv_find_first_not_of(StringView sv, const SvByteSet *set) SV_NOEXCEPT
+{
+    return sv_find_first_not_of_from(sv, 0, set);
+}
+
+SVDEF size_t
+sv_find_last_of(StringView sv, const SvByteSet *set) SV_NOEXCEPT
+{
+    return sv_find_last_of_from(sv, SV_NPOS, set);
+}
+
+SVDEF size_t
+sv_find_last_not_of(StringView sv, const SvByteSet *set) SV_NOEXCEPT
+{
+    return sv_find_last_not_of_from(sv, SV_NPOS, set);
+}
+
+SVDEF size_t
+sv_find_first_of_from(StringView sv, size_t pos, const SvByteSet *set) SV_NOEXCEPT
+{
+    SV_ASSERT(set != NULL);
+    if (pos >= sv.length) return SV_NPOS;
+
+    const size_t i = sv_byteset_scan_(set, (const unsigned char *)sv.begin + pos, sv.length - pos, true);
+    return i == SV_NPOS ? SV_NPOS : pos + i;
+}
+
+SVDEF size_t
+sv_find_first_not_of_from(StringView sv, size_t pos, const SvByteSet *set) SV_NOEXCEPT
+{
+    SV_ASSERT(set != NULL);
+    if (pos >= sv.length) return SV_NPOS;
+
+    const size_t i = sv_byteset_scan_(set, (const unsigned char *)sv.begin + pos, sv.length - pos, false);
+    return i == SV_NPOS ? SV_NPOS : pos + i;
+}
+
+SVDEF size_t
+sv_find_last_of_from(StringView sv, size_t pos, const SvByteSet *set) SV_NOEXCEPT
+{
+    SV_ASSERT(set != NULL);
+    if (sv.length == 0)   return SV_NPOS;
+    if (pos >= sv.length) pos = sv.length-1;
+
+    return sv_byteset_rscan_(set, (const unsigned char *)sv.begin, pos+1, true);
+}
+
+SVDEF size_t
+sv_find_last_not_of_from(StringView sv, size_t pos, const SvByteSet *set) SV_NOEXCEPT
+{
+    SV_ASSERT(set != NULL);
+    if (sv.length == 0)   return SV_NPOS;
+    if (pos >= sv.length) pos = sv.length-1;
+
+    return sv_byteset_rscan_(set, (const unsigned char *)sv.begin, pos+1, false);
+}
+
+SVDEF StringView
+sv_trim_left(StringView sv) SV_NOEXCEPT
+{
+#ifdef SV_TRIM_ASCII
+    return sv_trim_left_ascii(sv);
+#else
+    size_t i = 0;
+    while (i < sv.length && isspace((unsigned char)sv.begin[i])) i += 1;
+
+    return sv_from_parts(sv.begin + i, sv.length - i);
+#endif
+}
+
+SVDEF StringView
+sv_trim_right(StringView sv) SV_NOEXCEPT
+{
+#ifdef SV_TRIM_ASCII
+    return sv_trim_right_ascii(sv);
+#else
+    size_t i = 0;
+    while (i < sv.length && isspace((unsigned char)sv.begin[sv.length - i - 1])) i += 1;
+
+    return sv_from_parts(sv.begin, sv.length - i);
+#endif
+}
+
+SVDEF StringView
+sv_trim(StringView sv) SV_NOEXCEPT
+{
+    return sv_trim_right(sv_trim_left(sv));
+}
+
+static inline bool
+sv_is_ascii_space_(unsigned char c)
+{
+    return c == ' ' || (unsigned char)(c - '\t') <= '\r' - '\t';
+}
+
+// Whitespace is ' ' or a byte in ['\t', '\r']; the range test is an unsigned
+// compare done as min(x - '\t', 4) == x - '\t'.
+#if SV_HAS_AVX2
+static inline uint32_t
+sv_ascii_space_mask32_(const unsigned char *p)
+{
+    const __m256i v     = _mm256_loadu_si256((const __m256i *)p);
+    const __m256i shift = _mm256_sub_epi8(v, _mm256_set1_epi8('\t'));
+    const __m256i ctl   = _mm256_cmpeq_epi8(_mm256_min_epu8(shift, _mm256_set1_epi8('\r' - '\t')), shift);
+    const __m256i space = _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' '));
+    return (uint32_t)_mm256_movemask_epi8(_mm256_or_si256(ctl, space));
+}
+#endif
+
+#if SV_HAS_SSE2
+static inline uint32_t
+sv_ascii_space_mask16_(const unsigned char *p)
+{
+    const __m128i v     = _mm_loadu_si128((const __m128i *)p);
+    const __m128i shift = _mm_sub_epi8(v, _mm_set1_epi8('\t'));
+    const __m128i ctl   = _mm_cmpeq_epi8(_mm_min_epu8(shift, _mm_set1_epi8('\r' - '\t')), shift);
+    const __m128i space = _mm_cmpeq_epi8(v, _mm_set1_epi8(' '));
+    return (uint32_t)_mm_movemask_epi8(_mm_or_si128(ctl, space));
+}
+#endif
+
+// Number of leading whitespace bytes in p[0..n)
+static inline size_t
+sv_ascii_space_prefix_(const unsigned char *p, size_t n)
+{
+    size_t i = 0;
+#if SV_HAS_AVX2
+    while (n - i >= 32) {
+        const uint32_t other = ~sv_ascii_space_mask32_(p + i);
+        if (other) return i + sv_ctz32_(other);
+        i += 32;
+    }
+#endif
+#if SV_HAS_SSE2
+    while (n - i >= 16) {
+        const uint32_t other = ~sv_ascii_space_mask16_(p + i) & 0xFFFFu;
+        if (other) return i + sv_ctz32_(other);
+        i += 16;
+    }
+#endif
+    while (i < n && sv_is_ascii_space_(p[i])) i += 1;
+    return i;
+}
+
+// Number of trailing whitespace bytes in p[0..n)
+static inline size_t
+sv_ascii_space_suffix_(const unsigned char *p, size_t n)
+{
+    size_t end = n;
+#if SV_HAS_AVX2
+    while (end >= 32) {
+        const uint32_t other = ~sv_ascii_space_mask32_(p + end - 32);
+        if (other) return n - (end - 32 + sv_msb32_(other) + 1);
+        end -= 32;
+    }
+#endif
+#if SV_HAS_SSE2
+    while (end >= 16) {
+        const uint32_t other = ~sv_ascii_space_mask16_(p + end - 16) & 0xFFFFu;
+        if (other) return n - (end - 16 + sv_msb32_(other) + 1);
+        end -= 16;
+    }
+#endif
+    while (end > 0 && sv_is_ascii_space_(p[end - 1])) end -= 1;
+    return n - end;
+}
+
+SVDEF StringView
+sv_trim_left_ascii(StringView sv) SV_NOEXCEPT
+{
+    const size_t i = sv_ascii_space_prefix_((const unsigned char *)sv.begin, sv.length);
+    return sv_from_parts(sv.begin + i, sv.length - i);
+}
+
+SVDEF StringView
+sv_trim_right_ascii(StringView sv) SV_NOEXCEPT
+{
+    const size_t i = sv_ascii_space_suffix_((const unsigned char *)sv.begin, sv.length);
+    return sv_from_parts(sv.begin, sv.length - i);
+}
+
+SVDEF StringView
+sv_trim_ascii(StringView sv) SV_NOEXCEPT
+{
+    return sv_trim_right_ascii(sv_trim_left_ascii(sv));
+}
+
+SVDEF StringView
+sv_trim_left_set(StringView sv, const SvByteSet *set) SV_NOEXCEPT
+{
+    const size_t i = sv_find_first_not_of(sv, set);
+    return i == SV_NPOS ? sv_drop(sv, sv.length) : sv_drop(sv, i);
+}
+
+SVDEF StringView
+sv_trim_right_set(StringView sv, const SvByteSet *set) SV_NOEXCEPT
+{
+    const size_t i = sv_find_last_not_of(sv, set);
+    return i == SV_NPOS ? sv_take(sv, 0) : sv_take(sv, i + 1);
+}
+
+SVDEF StringView
+sv_trim_set(StringView sv, const SvByteSet *set) SV_NOEXCEPT
+{
+    return sv_trim_right_set(sv_trim_left_set(sv, set), set);
+}
+
+SVDEF StringView
+sv_take(StringView sv, size_t n) SV_NOEXCEPT
+{
+    SV_ASSERT(n <= sv.length);
+    return sv_substr(sv, 0, n);
+}
+
+SVDEF StringView
+sv_drop(StringView sv, size_t n) SV_NOEXCEPT
+{
+    SV_ASSERT(n <= sv.length);
+    return sv_substr(sv, n, sv.length-n);
+}
+
+SVDEF StringView
+sv_take_last(StringView sv, size_t n) SV_NOEXCEPT
+{
+    SV_ASSERT(n <= sv.length);
+    return sv_substr(sv, sv.length-n, n);
+}
+
+SVDEF StringView
+sv_drop_last(StringView sv, size_t n) SV_NOEXCEPT
+{
+    SV_ASSERT(n <= sv.length);
+    return sv_substr(sv, 0, sv.length-n);
+}
+
+SVDEF StringView
+sv_take_and_consume(StringView *sv, size_t n) SV_NOEXCEPT
+{
+    SV_ASSERT(n <= sv->length);
+
+    StringView out = sv_empty();
+    out.begin = sv->begin;
+    out.length = n;
+    sv->begin  += n;
+    sv->length -= n;
+    return out;
+}
+
+SVDEF StringView
+sv_drop_and_consume(StringView *sv, size_t n) SV_NOEXCEPT
+{
+    SV_ASSERT(n <= sv->length);
+
+    sv->begin  += n;
+    sv->length -= n;
+    return *sv;
+}
+
+SVDEF StringView
+sv_take_last_and_consume(StringView *sv, size_t n) SV_NOEXCEPT
+{
+    SV_ASSERT(n <= sv->length);
+
+    StringView out = sv_empty();
+    out.begin = sv->begin + (sv->length - n);
+    out.length = n;
+    sv->length -= n;
+    return out;
+}
+
+SVDEF StringView
+sv_drop_last_and_consume(StringView *sv, size_t n) SV_NOEXCEPT
+{
+    SV_ASSERT(n <= sv->length);
+
+    sv->length -= n;
+    return *sv;
+}
+
+
+SVDEF void
+sv_split_first(StringView  sv,
+               char        delim,
+               StringView *out_before_delim,
+               StringView *out_after_delim) SV_NOEXCEPT
+{
+    const void *p = (sv.length ? memchr(sv.begin, (unsigned char)delim, sv.length) : NULL);
+    if (!p) {
+        if (out_before_delim) *out_before_delim = sv;
+        if (out_after_delim)  *out_after_delim  = sv_empty();
+        return;
+    }
+
+    size_t idx = (size_t)((const char *)p - sv.begin);
+    if (out_before_delim) *out_before_delim = sv_substr(sv, 0, idx);
+    if (out_after_delim)  *out_after_delim  = sv_substr(sv, idx+1, sv.length-idx-1);
+}
+
+SVDEF void
+sv_split_last(StringView  sv,
+              char        delim,
+              StringView *out_before_delim,
+              StringView *out_after_delim) SV_NOEXCEPT
+{
+    const void *p = (sv.length ? sv_memrchr_(sv.begin, (unsigned char)delim, sv.length) : NULL);
+    if (!p) {
+        if (out_before_delim) *out_before_delim = sv;
+        if (out_after_delim)  *out_after_delim  = sv_empty();
+        return;
+    }
+
+    size_t idx = (size_t)((const char *)p - sv.begin);
+    if (out_before_delim) *out_before_delim = sv_substr(sv, 0, idx);
+    if (out_after_delim)  *out_after_delim  = sv_substr(sv, idx+1, sv.length-idx-1);
+}
+
+SVDEF void
+sv_split_once_from(StringView  sv,
+                   char        delim,
+                   size_t      pos,
+                   StringView *out_before_delim,
+                   StringView *out_after_delim) SV_NOEXCEPT
+{
+    if (pos > sv.length) pos = sv.length;
+
+    const void *p = (sv.length ? memchr(sv.begin + pos, (unsigned char)delim, sv.length - pos) : NULL);
+    if (!p) {
+        if (out_before_delim) *out_before_delim = sv;
+        if (out_after_delim)  *out_after_delim  = sv_empty();
+        return;
+    }
+
+    size_t idx = (size_t)((const char *)p - sv.begin);
+    if (out_before_delim) *out_before_delim = sv_substr(sv, 0, idx);
+    if (out_after_delim)  *out_after_delim  = sv_substr(sv, idx+1, sv.length-idx-1);
+}
+
+SVDEF void
+sv_split_first_of(StringView       sv,
+                  const SvByteSet *delims,
+                  StringView      *out_before_delim,
+                  StringView      *out_after_delim) SV_NOEXCEPT
+{
+    const size_t idx = sv_find_first_of(sv, delims);
+    if (idx == SV_NPOS) {
+        if (out_before_delim) *out_before_delim = sv;
+        if (out_after_delim)  *out_after_delim  = sv_empty();
+        return;
+    }
+
+    if (out_before_delim) *out_before_delim = sv_substr(sv, 0, idx);
+    if (out_after_delim)  *out_after_delim  = sv_substr(sv, idx+1, sv.length-idx-1);
+}
+
+SVDEF size_t
+sv_split_into(StringView  sv,
+              char        delim,
+              StringView *out,
+              size_t      cap,
+              size_t     *out_next) SV_NOEXCEPT
+{
+    SV_ASSERT(out != NULL || cap == 0);
+
+    const unsigned char *p     = (const unsigned char *)sv.begin;
+    const unsigned char  c     = (unsigned char)delim;
+    size_t               count = 0;
+    size_t               start = 0;
+
+    if (out_next) *out_next = SV_NPOS;
+    if (cap == 0) {
+        if (out_next) *out_next = 0;
+        return 0;
+    }
+
+    // Delimiter positions come from a 64-bit mask per block, so each field costs
+    // a ctz and a store instead of a separate scan.
+    for (size_t block = 0; block < sv.length; block += 64) {
+        uint64_t mask;
+        if (sv.length - block >= 64) {
+            mask = sv_eq_mask64_(p + block, c);
+        } else {
+            unsigned char tail[64];
+            memset(tail, (unsigned char)~c, sizeof tail);
+            memcpy(tail, p + block, sv.length - block);
+            mask = sv_eq_mask64_(tail, c);
+        }
+
+        while (mask) {
+            const size_t idx = block + sv_ctz64_(mask);
+            mask &= mask - 1;
+
+            out[count++] = sv_from_parts(sv.begin + start, idx - start);
+            start = idx + 1;
+            if (count == cap) {
+                if (out_next) *out_next = start;
+                return count;
+            }
+        }
+    }
+
+    out[count++] = sv_from_parts(sv.begin + start, sv.length - start);
+    return count;
+}
+
+static inline void
+sv_split_iter_reset_(SvSplitIter *it, StringView sv, SvSplitKind kind)
+{
+    SV_ASSERT(it != NULL);
+
+    memset(it, 0, sizeof *it);
+    it->rest = sv;
+    it->kind = kind;
+}
+
+SVDEF void
+sv_split_iter_init_char(SvSplitIter *it, StringView sv, char delim) SV_NOEXCEPT
+{
+    sv_split_iter_reset_(it, sv, SV_SPLIT_CHAR);
+    it->delim_char = delim;
+}
+
+SVDEF void
+sv_split_iter_init_str(SvSplitIter *it, StringView sv, StringView delim) SV_NOEXCEPT
+{
+    sv_split_iter_reset_(it, sv, SV_SPLIT_STR);
+    sv_searcher_init(&it->delim_str, delim);
+}
+
+SVDEF void
+sv_split_iter_init_set(SvSplitIter *it, StringView sv, const SvByteSet *delims) SV_NOEXCEPT
+{
+    SV_ASSERT(delims != NULL);
+
+    sv_split_iter_reset_(it, sv, SV_SPLIT_SET);
+    it->delim_set = *delims;
+}
+
+// Position of the next delimiter in it->rest (SV_NPOS if none) and its length
+static inline size_t
+sv_split_iter_find_(const SvSplitIter *it, size_t *out_delim_length)
+{
+    *out_delim_length = 1;
+    switch (it->kind) {
+    case SV_SPLIT_CHAR:
+        return sv_find_char(it->rest, it->delim_char);
+    case SV_SPLIT_STR:
+        *out_delim_length = it->delim_str.needle.length;
+        if (*out_delim_length == 0) return SV_NPOS;
+        return sv_searcher_find(&it->delim_str, it->rest);
+    case SV_SPLIT_SET:
+        return sv_find_first_of(it->rest, &it->delim_set);
+    }
+    return SV_NPOS;
+}
+
+// Drop delimiters at the start of it->rest
+static inline void
+sv_split_iter_skip_delims_(SvSplitIter *it)
+{
+    size_t n = 0;
+    switch (it->kind) {
+    case SV_SPLIT_CHAR:
+        while (n < it->rest.length && it->rest.begin[n] == it->delim_char) n += 1;
+        break;
+    case SV_SPLIT_STR: {
+        const StringView delim = it->delim_str.needle;
+        if (delim.length == 0) break;
+        while (it->rest.length - n >= delim.length &&
+               memcmp(it->rest.begin + n, delim.begin, delim.length) == 0) {
+            n += delim.length;
+        }
+        break;
+    }
+    case SV_SPLIT_SET:
+        n = sv_find_first_not_of(it->rest, &it->delim_set);
+        if (n == SV_NPOS) n = it->rest.length;
+        break;
+    }
+    it->rest = sv_drop(it->rest, n);
+}
+
+SVDEF bool
+sv_split_next(SvSplitIter *it, StringView *out_field) SV_NOEXCEPT
+{
+    SV_ASSERT(it != NULL);
+
+    while (!it->done) {
+        StringView field;
+        if (it->max_fields && it->count + 1 >= it->max_fields) {
+            if (it->skip_empty) sv_split_iter_skip_delims_(it);
+            field    = it->rest;
+            it->done = true;
+        } else {
+            size_t       delim_length;
+            const size_t idx = sv_split_iter_find_(it, &delim_length);
+            if (idx == SV_NPOS) {
+                field    = it->rest;
+                it->done = true;
+            } else {
+                field    = sv_take(it->rest, idx);
+                it->rest = sv_drop(it->rest, idx + delim_length);
+            }
+        }
+
+        if (it->skip_empty && field.length == 0) continue;
+
+        it->count += 1;
+        if (out_field) *out_field = field;
+        return true;
+    }
+    return false;
+}
+
+SVDEF void
+sv_line_iter_init(SvLineIter *it, StringView sv) SV_NOEXCEPT
+{
+    SV_ASSERT(it != NULL);
+
+    memset(it, 0, sizeof *it);
+    it->rest = sv;
+}
+
+// Line of sv spanning [start, newline], with or without its terminator
+static inline StringView
+sv_line_make_(const SvLineIter *it, StringView sv, size_t start, size_t newline)
+{
+    if (it->keep_terminators) return sv_from_parts(sv.begin + start, newline + 1 - start);
+
+    size_t length = newline - start;
+    if (length > 0 && sv.begin[newline - 1] == '\r') length -= 1;
+    return sv_from_parts(sv.begin + start, length);
+}
+
+SVDEF bool
+sv_line_next(SvLineIter *it, StringView *out_line) SV_NOEXCEPT
+{
+    SV_ASSERT(it != NULL);
+
+    const StringView sv = it->rest;
+    if (sv.length == 0) return false;
+
+    StringView  line;
+    const char *nl = (const char *)memchr(sv.begin, '\n', sv.length);
+    if (nl) {
+        const size_t idx = (size_t)(nl - sv.begin);
+        line     = sv_line_make_(it, sv, 0, idx);
+        it->rest = sv_drop(sv, idx + 1);
+    } else {
+        line     = sv;
+        it->rest = sv_drop(sv, sv.length);
+    }
+
+    it->count += 1;
+    if (out_line) *out_line = line;
+    return true;
+}
+
+SVDEF size_t
+sv_line_next_batch(SvLineIter *it, StringView *out, size_t cap) SV_NOEXCEPT
+{
+    SV_ASSERT(it != NULL);
+    SV_ASSERT(out != NULL || cap == 0);
+
+    const StringView     sv    = it->rest;
+    const unsigned char *p     = (const unsigned char *)sv.begin;
+    size_t               count = 0;
+    size_t               start = 0;
+
+    if (cap == 0 || sv.length == 0) return 0;
+
+    for (size_t block = 0; block < sv.length; block += 64) {
+        uint64_t mask;
+        if (sv.length - block >= 64) {
+            mask = sv_eq_mask64_(p + block, '\n');
+        } else {
+            unsigned char tail[64];
+            memset(tail, 0, sizeof tail);
+            memcpy(tail, p + block, sv.length - block);
+            mask = sv_eq_mask64_(tail, '\n');
+        }
+
+        while (mask) {
+            const size_t idx = block + sv_ctz64_(mask);
+            mask &= mask - 1;
+
+            out[count++] = sv_line_make_(it, sv, start, idx);
+            start = idx + 1;
+            if (count == cap) {
+                it->rest   = sv_drop(sv, start);
+                it->count += count;
+                return count;
+            }
+        }
+    }
+
+    if (start < sv.length) out[count++] = sv_drop(sv, start);
+    it->rest   = sv_drop(sv, sv.length);
+    it->count += count;
+    return count;
+}
+
+SVDEF SvCsvOptions
+sv_csv_default_options(SV_NO_PARAMS) SV_NOEXCEPT
+{
+    SvCsvOptions options;
+    options.delimiter = ',';
+    options.quote     = '"';
+    options.newline   = '\n';
+    options.crlf      = true;
+    return options;
+}
+
+SVDEF void
+sv_csv_init(SvCsvReader *r, StringView input, const SvCsvOptions *options) SV_NOEXCEPT
+{
+    SV_ASSERT(r != NULL);
+
+    memset(r, 0, sizeof *r);
+    r->options = options ? *options : sv_csv_default_options();
+    r->input   = input;
+    r->rest    = input;
+}
+
+static inline bool
+sv_csv_fail_(SvCsvReader *r)
+{
+    r->error        = true;
+    r->error_offset = (size_t)(r->rest.begin - r->input.begin);
+    return false;
+}
+
+SVDEF bool
+sv_csv_next_field(SvCsvReader *r, SvCsvField *out_field) SV_NOEXCEPT
+{
+    SV_ASSERT(r != NULL);
+
+    if (r->error) return false;
+
+    const SvCsvOptions *o    = &r->options;
+    const StringView    rest = r->rest;
+    SvCsvField          field;
+    memset(&field, 0, sizeof field);
+
+    if (rest.length == 0) {
+        // "a," ends in an empty field, anything else at the end is just the end
+        if (!r->field_pending) return false;
+        r->field_pending     = false;
+        field.value          = rest;
+        field.last_in_record = true;
+        if (out_field) *out_field = field;
+        return true;
+    }
+
+    size_t end;  // Offset of the terminator (or rest.length)
+    if (rest.begin[0] == o->quote) {
+        // Jump from quote to quote; a doubled quote is an escape, anything
+        // else closes the field.
+        size_t i = 1;
+        for (;;) {
+            const char *q = (const char *)memchr(rest.begin + i, (unsigned char)o->quote, rest.length - i);
+            if (!q) return sv_csv_fail_(r);
+            i = (size_t)(q - rest.begin) + 1;
+            if (i < rest.length && rest.begin[i] == o->quote) {
+                field.needs_unescape = true;
+                i += 1;
+                continue;
+            }
+            break;
+        }
+        field.quoted = true;
+        field.value  = sv_from_parts(rest.begin + 1, i - 2);
+        end          = i;
+
+        if (end < rest.length && rest.begin[end] != o->delimiter && rest.begin[end] != o->newline) {
+            if (o->crlf && rest.begin[end] == '\r' &&
+                (end + 1 == rest.length || rest.begin[end + 1] == o->newline)) {
+                end += 1;
+            } else {
+                return sv_csv_fail_(r);
+            }
+        }
+    } else {
+        // Unquoted fields cannot contain structural bytes, so a single
+        // vectorized scan for the delimiter or newline finds the end.
+        const char *p = sv_memchr3_(rest.begin, rest.length, (unsigned char)o->delimiter,
+                                    (unsigned char)o->newline, (unsigned char)o->newline);
+        end = p ? (size_t)(p - rest.begin) : rest.length;
+
+        size_t length = end;
+        if (o->crlf && length > 0 && rest.begin[length - 1] == '\r' &&
+            (end == rest.length || rest.begin[end] == o->newline)) {
+            length -= 1;
+        }
+        field.value = sv_take(rest, length);
+    }
+
+    if (end < rest.length && rest.begin[end] == o->delimiter) {
+        r->field_pending = true;
+    } else {
+        r->field_pending     = false;
+        field.last_in_record = true;
+    }
+    r->rest = sv_drop(rest, end < rest.length ? end + 1 : end);
+
+    if (out_field) *out_field = field;
+    return true;
+}
+
+SVDEF size_t
+sv_csv_next_record(SvCsvReader *r, SvCsvField *fields, size_t cap) SV_NOEXCEPT
+{
+    SV_ASSERT(r != NULL);
+    SV_ASSERT(fields != NULL || cap == 0);
+
+    size_t     count = 0;
+    SvCsvField field;
+    while (sv_csv_next_field(r, &field)) {
+        if (count < cap) fields[count] = field;
+        count += 1;
+        if (field.last_in_record) return count;
+    }
+    return r->error ? 0 : count;
+}
+
+SVDEF bool
+sv_csv_error(const SvCsvReader *r, size_t *out_offset) SV_NOEXCEPT
+{
+    SV_ASSERT(r != NULL);
+
+    if (r->error && out_offset) *out_offset = r->error_offset;
+    return r->error;
+}
+
+SVDEF StringView
+sv_csv_unescape(StringView  value,
+                char        quote,
+                char       *buffer,
+                size_t      buffer_size) SV_NOEXCEPT
+{
+    SV_ASSERT(buffer != NULL || buffer_size == 0);
+
+    size_t n = 0;
+    size_t i = 0;
+    while (i < value.length && n < buffer_size) {
+        // Copy up to and including the next quote, then skip its twin
+        const char  *q    = (const char *)memchr(value.begin + i, (unsigned char)quote, value.length - i);
+        const size_t stop = q ? (size_t)(q - value.begin) + 1 : value.length;
+        size_t       run  = stop - i;
+        if (run > buffer_size - n) run = buffer_size - n;
+
+        memcpy(buffer + n, value.begin + i, run);
+        n += run;
+        i += run;
+        if (q && i == stop && i < value.length && value.begin[i] == quote) i += 1;
+    }
+    return sv_from_parts(buffer, n);
+}
+
+SVDEF size_t
+sv_to_cstr(StringView  sv,           // Adds null-terminator, you should
+           char       *buffer,       // allocate .length+1 to avoid truncation
+           size_t      buffer_size)  SV_NOEXCEPT
+{
+    if (buffer_size == 0) {
+        return 0;
+    }
+
+    size_t n = sv.length;
+    if (n > buffer_size - 1) {
+        n = buffer_size - 1;
+    }
+
+    if (n > 0) {
+        memcpy(buffer, sv.begin, n);
+    }
+    buffer[n] = '\0';
+
+    return n;
+}
+
+// Little-endian load of 8 bytes, so byte i of the string is bits [8i, 8i+8)
+static inline uint64_t
+sv_load_le64_(const char *p)
+{
+    uint64_t w;
+    memcpy(&w, p, 8);
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    w = __builtin_bswap64(w);
+#endif
+    return w;
+}
+
+// Convert 8 ASCII digits at p, or return false if any byte is not a digit.
+// SWAR: each byte has '0'..'9' iff its high nibble is 3 and adding 6 does not
+// carry into the high nibble. The digits are then folded pairwise with
+// multiplies: 8 x 1 digit -> 4 x 2 digits -> 1 x 8 digits.
+static inline bool
+sv_parse8_digits_(const char *p, uint64_t *out)
+{
+    const uint64_t w = sv_load_le64_(p);
+    if ((w & 0xF0F0F0F0F0F0F0F0ULL) != 0x3030303030303030ULL ||
+        ((w + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) != 0x3030303030303030ULL) {
+        return false;
+    }
+
+    uint64_t v = w - 0x3030303030303030ULL;
+    v = (v * 10) + (v >> 8);
+    v = (((v & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+         (((v >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+    *out = v;
+    return true;
+}
+
+#if SV_HAS_SSSE3
+// Convert 16 ASCII digits at p with SSSE3, or return false if any byte is not
+// a digit. pmaddubsw/pmaddwd fold digit pairs into 2-, 4- and 8-digit lanes;
+// 4-digit lanes are < 10000, so the signed packssdw (SSE2) is exact.
+static inline bool
+sv_parse16_digits_(const char *p, uint64_t *out)
+{
+    const __m128i v = _mm_sub_epi8(_mm_loadu_si128((const __m128i *)p), _mm_set1_epi8('0'));
+    // Digits are bytes in [0, 9] after the subtraction; min(x, 9) == x tests it unsigned
+    const __m128i ok = _mm_cmpeq_epi8(_mm_min_epu8(v, _mm_set1_epi8(9)), v);
+    if (_mm_movemask_epi8(ok) != 0xFFFF) return false;
+
+    const __m128i pairs = _mm_maddubs_epi16(v, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1,
+                                                              10, 1, 10, 1, 10, 1, 10, 1));
+    const __m128i quads = _mm_madd_epi16(pairs, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+    const __m128i packed = _mm_packs_epi32(quads, quads);
+    const __m128i octs  = _mm_madd_epi16(packed, _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
+
+    const uint64_t hi = (uint32_t)_mm_cvtsi128_si32(octs);
+    const uint64_t lo = (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(octs, 4));
+    *out = hi * 100000000ULL + lo;
+    return true;
+}
+#endif
+
+// Parse exactly n ASCII digits at p into *out. Returns false on a non-digit
+// or if the value does not fit in 64 bits. Leading zeros are skipped first,
+// after which at most 20 digits can fit; the first 19 can never overflow, so
+// they go through the chunked converters and only a 20th digit is checked.
+static inline bool
+sv_parse_digits_u64_(const char *p, size_t n, uint64_t *out)
+{
+    while (n >= 8 && sv_load_le64_(p) == 0x3030303030303030ULL) { p += 8; n -= 8; }
+    while (n > 0 && *p == '0') { p++; n--; }
+
+    if (n > 20) return false; // Cannot fit, whether or not it is all digits
+
+    const size_t fast = n < 20 ? n : 19;
+    uint64_t     acc  = 0;
+    size_t       i    = 0;
+    uint64_t     chunk;
+
+#if SV_HAS_SSSE3
+    if (fast >= 16) {
+        if (!sv_parse16_digits_(p, &chunk)) return false;
+        acc = chunk;
+        i   = 16;
+    }
+#endif
+    while (fast - i >= 8) {
+        if (!sv_parse8_digits_(p + i, &chunk)) return false;
+        acc = acc * 100000000ULL + chunk;
+        i  += 8;
+    }
+    for (; i < fast; ++i) {
+        const unsigned char c = (unsigned char)p[i];
+        if (c < '0' || c > '9') return false;
+        acc = acc * 10ULL + (uint64_t)(c - '0');
+    }
+
+    if (n == 20) {
+        const unsigned char c = (unsigned char)p[19];
+        if (c < '0' || c > '9') return false;
+        const uint32_t d = (uint32_t)(c - '0');
+        // acc*10 + d <= UINT64_MAX  =>  acc <= UINT64_MAX/10
+        if (acc > UINT64_MAX / 10ULL ||
+            (acc == UINT64_MAX / 10ULL && d > (UINT64_MAX % 10ULL))) {
+            return false; // overflow
+        }
+        acc = acc * 10ULL + (uint64_t)d;
+    }
+
+    *out = acc;
+    return true;
+}
+
+// Length of the run of ASCII digits at the start of p[0..n), a word at a time:
+// a byte is flagged when its high nibble is not 3 or adding 6 carries out of
+// its low nibble, and the lowest flagged byte is the first non-digit.
+static inline size_t
+sv_digit_run_(const char *p, size_t n)
+{
+    size_t i = 0;
+    while (n - i >= 8) {
+        const uint64_t w    = sv_load_le64_(p + i);
+        const uint64_t flag = ((w & 0xF0F0F0F0F0F0F0F0ULL) ^ 0x3030303030303030ULL) |
+                              (((w + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) ^ 0x3030303030303030ULL);
+        if (flag) return i + sv_ctz64_(flag) / 8;
+        i += 8;
+    }
+    while (i < n && p[i] >= '0' && p[i] <= '9') i += 1;
+    return i;
+}
+
+// Returns true on success, false on invalid/overflow.
+// Accepts optional leading '+' for u64.
+SVDEF bool
+sv_to_uint64(StringView sv, uint64_t *out) SV_NOEXCEPT
+{
+    if (!out || sv.length == 0) return false;
+
+    const char *p = sv.begin;
+    size_t      n = sv.length;
+
+    // Optional '+'
+    if (*p == '+') { p++; if (--n == 0) return false; }
+
+    uint64_t acc;
+    if (!sv_parse_digits_u64_(p, n, &acc)) return false;
+
+    *out = acc;
+    return true;
+}
+
+// Returns true on success, false on invalid/overflow.
+// Accepts leading '+' or '-'.
+SVDEF bool
+sv_to_int64(StringView sv, int64_t *out) SV_NOEXCEPT
+{
+    if (!out || sv.length == 0) return false;
+
+    const char *p = sv.begin;
+    size_t      n = sv.length;
+
+    bool neg = false;
+    if (*p == '+' || *p == '-') {
+        neg = (*p == '-');
+        p++; if (--n == 0) return false;
+    }
+
+    // We parse as unsigned then range-check against the signed limits.
+    uint64_t acc;
+    const uint64_t pos_limit = (uint64_t)INT64_MAX;          //  9223372036854775807
+    const uint64_t neg_limit = (uint64_t)INT64_MAX + 1ULL;   //  9223372036854775808
+    const uint64_t limit     = neg ? neg_limit : pos_limit;
+
+    if (!sv_parse_digits_u64_(p, n, &acc)) return false;
+    if (acc > limit) return false; // overflow
+
+    if (neg) {
+        if (acc == neg_limit) { *out = INT64_MIN; return true; }
+        *out = -(int64_t)acc;
+    } else {
+        *out = (int64_t)acc;
+    }
+    return true;
+}
+
+// Value of an ASCII digit in bases up to 36, or 36 if c is not one
+static inline unsigned
+sv_base_digit_(unsigned char c)
+{
+    if ((unsigned char)(c - '0') <= 9) return (unsigned)(c - '0');
+    c |= 0x20;
+    if ((unsigned char)(c - 'a') < 26) return (unsigned)(c - 'a') + 10;
+    return 36;
+}
+
+// Decode 16 hex digits at p into 8 bytes (first digit pair -> out[0]), or
+// return false if any byte is not a hex digit.
+static inline bool
+sv_hex16_(const char *p, unsigned char out[8])
+{
+#if SV_HAS_SSSE3
+    // Digits and letters are classified with unsigned range checks done as
+    // min(x, hi) == x, mapped to nibbles, and pairs fused with pmaddubsw.
+    const __m128i c      = _mm_loadu_si128((const __m128i *)p);
+    const __m128i digit  = _mm_sub_epi8(c, _mm_set1_epi8('0'));
+    const __m128i letter = _mm_sub_epi8(_mm_or_si128(c, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    const __m128i is_dig = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+    const __m128i is_let = _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+    if (_mm_movemask_epi8(_mm_or_si128(is_dig, is_let)) != 0xFFFF) return false;
+
+    const __m128i nibble = _mm_or_si128(_mm_and_si128(is_dig, digit),
+                                        _mm_andnot_si128(is_dig, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+    const __m128i bytes  = _mm_maddubs_epi16(nibble, _mm_setr_epi8(16, 1, 16, 1, 16, 1, 16, 1,
+                                                                   16, 1, 16, 1, 16, 1, 16, 1));
+    _mm_storel_epi64((__m128i *)out, _mm_packus_epi16(bytes, bytes));
+    return true;
+#else
+    for (size_t i = 0; i < 8; ++i) {
+        const unsigned hi = sv_base_digit_((unsigned char)p[2 * i]);
+        const unsigned lo = sv_base_digit_((unsigned char)p[2 * i + 1]);
+        if (hi > 15 || lo > 15) return false;
+        out[i] = (unsigned char)(hi << 4 | lo);
+    }
+    return true;
+#endif
+}
+
+// Length of the base prefix at p[0..n) for the requested base (0 or 2), with
+// the resolved base in *out_base. Returns SV_NPOS for an unsupported base.
+static inline size_t
+sv_base_prefix_(const char *p, size_t n, int base, unsigned *out_base)
+{
+    if (base != 0 && (base < 2 || base > 36)) return SV_NPOS;
+
+    unsigned detected = 0;
+    if (n >= 2 && p[0] == '0') {
+        const char c = (char)(p[1] | 0x20);
+        if (c == 'x') detected = 16;
+        if (c == 'o') detected = 8;
+        if (c == 'b') detected = 2;
+    }
+
+    if (base == 0) {
+        *out_base = detected ? detected : 10;
+        return detected ? 2 : 0;
+    }
+    *out_base = (unsigned)base;
+    return detected == (unsigned)base ? 2 : 0;
+}
+
+// Parse exactly n digits of base at p. False on a bad digit or overflow.
+static inline bool
+sv_parse_base_u64_(const char *p, size_t n, unsigned base, uint64_t *out)
+{
+    if (base == 10) return sv_parse_digits_u64_(p, n, out);
+
+    while (n > 0 && *p == '0') { p++; n--; }
+
+    if (base == 16) {
+        if (n > 16) return false;
+
+        // Right-align into 16 '0' digits and decode as big-endian bytes
+        char          buf[16];
+        unsigned char bytes[8];
+        memset(buf, '0', sizeof buf);
+        if (n > 0) memcpy(buf + 16 - n, p, n);
+        if (!sv_hex16_(buf, bytes)) return false;
+
+        uint64_t acc = 0;
+        for (size_t i = 0; i < 8; ++i) acc = acc << 8 | bytes[i];
+        *out = acc;
+        return true;
+    }
+
+    const uint64_t limit = UINT64_MAX / base;
+    const uint64_t rem   = UINT64_MAX % base;
+    uint64_t       acc   = 0;
+    for (size_t i = 0; i < n; ++i) {
+        const unsigned d = sv_base_digit_((unsigned char)p[i]);
+        if (d >= base) return false;
+        if (acc > limit || (acc == limit && d > rem)) return false; // overflow
+        acc = acc * base + d;
+    }
+    *out = acc;
+    return true;
+}
+
+SVDEF bool
+sv_to_uint64_base(StringView sv, int base, uint64_t *out) SV_NOEXCEPT
+{
+    if (!out || sv.length == 0) return false;
+
+    const char *p = sv.begin;
+    size_t      n = sv.length;
+
+    // Optional '+'
+    if (*p == '+') { p++; n--; }
+
+    unsigned     b;
+    const size_t prefix = sv_base_prefix_(p, n, base, &b);
+    if (prefix == SV_NPOS || n - prefix == 0) return false;
+
+    uint64_t acc;
+    if (!sv_parse_base_u64_(p + prefix, n - prefix, b, &acc)) return false;
+
+    *out = acc;
+    return true;
+}
+
+SVDEF bool
+sv_to_int64_base(StringView sv, int base, int64_t *out) SV_NOEXCEPT
+{
+    if (!out || sv.length == 0) return false;
+
+    const char *p = sv.begin;
+    size_t      n = sv.length;
+
+    bool neg = false;
+    if (*p == '+' || *p == '-') {
+        neg = (*p == '-');
+        p++; n--;
+    }
+
+    unsigned     b;
+    const size_t prefix = sv_base_prefix_(p, n, base, &b);
+    if (prefix == SV_NPOS || n - prefix == 0) return false;
+
+    uint64_t       acc;
+    const uint64_t limit = neg ? (uint64_t)INT64_MAX + 1ULL : (uint64_t)INT64_MAX;
+    if (!sv_parse_base_u64_(p + prefix, n - prefix, b, &acc) || acc > limit) return false;
+
+    if (neg) *out = acc == limit ? INT64_MIN : -(int64_t)acc;
+    else     *out = (int64_t)acc;
+    return true;
+}
+
+SVDEF size_t
+sv_hex_decode(StringView sv, unsigned char *out, size_t out_size) SV_NOEXCEPT
+{
+    SV_ASSERT(out != NULL || out_size == 0);
+
+    if (sv.length % 2 != 0 || sv.length / 2 > out_size) return SV_NPOS;
+
+    const size_t bytes = sv.length / 2;
+    size_t       i     = 0;
+    for (; i + 8 <= bytes; i += 8) {
+        if (!sv_hex16_(sv.begin + 2 * i, out + i)) return SV_NPOS;
+    }
+    for (; i < bytes; ++i) {
+        const unsigned hi = sv_base_digit_((unsigned char)sv.begin[2 * i]);
+        const unsigned lo = sv_base_digit_((unsigned char)sv.begin[2 * i + 1]);
+        if (hi > 15 || lo > 15) return SV_NPOS;
+        out[i] = (unsigned char)(hi << 4 | lo);
+    }
+    return bytes;
+}
+
+SVDEF bool
+sv_to_long(StringView sv, long *out) SV_NOEXCEPT
+{
+    if (!out) return false;
+#if LONG_MAX == 2147483647L  // 32-bit long
+    int64_t tmp;
+    if (!sv_to_int64(sv, &tmp)) return false;
+    if (tmp < LONG_MIN || tmp > LONG_MAX) return false;
+    *out = (long)tmp;
+    return true;
+#else                         // 64-bit long
+    int64_t tmp;
+    if (!sv_to_int64(sv, &tmp)) return false;
+    *out = (long)tmp;
+    return true;
+#endif
+}
+
+// 64x64 -> 128-bit multiply. Returns the low half, stores the high half.
+static inline uint64_t
+sv_mul128_(uint64_t a, uint64_t b, uint64_t *hi)
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 sv_u128_;
+    const sv_u128_ r = (sv_u128_)a * b;
+    *hi = (uint64_t)(r >> 64);
+    return (uint64_t)r;
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return _umul128(a, b, hi);
+#else
+    const uint64_t a_lo = (uint32_t)a, a_hi = a >> 32;
+    const uint64_t b_lo = (uint32_t)b, b_hi = b >> 32;
+    const uint64_t ll = a_lo * b_lo, lh = a_lo * b_hi, hl = a_hi * b_lo, hh = a_hi * b_hi;
+    const uint64_t mid = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+    *hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+    return (mid << 32) | (uint32_t)ll;
+#endif
+}
+
+// x / 2^n rounded toward negative infinity (>> on negative values is implementation-defined)
+static inline int64_t
+sv_floor_shr_(int64_t x, unsigned n)
+{
+    return x >= 0 ? x >> n : -((-x + ((int64_t)1 << n) - 1) >> n);
+}
+
+#define SV_POW5_MIN_ -342
+#define SV_POW5_MAX_ 324
+
+// 128-bit approximations of 5^q for q in [SV_POW5_MIN_, SV_POW5_MAX_], normalized
+// so the top bit is set. They are also the significands of 10^q. Entries are
+// exact for q in [0, 55], rounded up for q in [-27, -1] and truncated otherwise.
+static const uint64_t sv_pow5_128_[SV_POW5_MAX_ - SV_POW5_MIN_ + 1][2] = {
+    {0xeef453d6923bd65aULL, 0x113faa2906a13b3fULL},
+    {0x9558b4661b6565f8ULL, 0x4ac7ca59a424c507ULL},
+    {0xbaaee17fa23ebf76ULL, 0x5d79bcf00d2df649ULL},
+    {0xe95a99df8ace6f53ULL, 0xf4d82c2c107973dcULL},
+    {0x91d8a02bb6c10594ULL, 0x79071b9b8a4be869ULL},
+    {0xb64ec836a47146f9ULL, 0x9748e2826cdee284ULL},
+    {0xe3e27a444d8d98b7ULL, 0xfd1b1b2308169b25ULL},
+    {0x8e6d8c6ab0787f72ULL, 0xfe30f0f5e50e20f7ULL},
+    {0xb208ef855c969f4fULL, 0xbdbd2d335e51a935ULL},
+    {0xde8b2b66b3bc4723ULL, 0xad2c788035e61382ULL},
+    {0x8b16fb203055ac76ULL, 0x4c3bcb5021afcc31ULL},
+    {0xaddcb9e83c6b1793ULL, 0xdf4abe242a1bbf3dULL},
+    {0xd953e8624b85dd78ULL, 0xd71d6dad34a2af0dULL},
+    {0x87d4713d6f33aa6bULL, 0x8672648c40e5ad68ULL},
+    {0xa9c98d8ccb009506ULL, 0x680efdaf511f18c2ULL},
+    {0xd43bf0effdc0ba48ULL, 0x0212bd1b2566def2ULL},
+    {0x84a57695fe98746dULL, 0x014bb630f7604b57ULL},
+    {0xa5ced43b7e3e9188ULL, 0x419ea3bd35385e2dULL},
+    {0xcf42894a5dce35eaULL, 0x52064cac828675b9ULL},
+    {0x818995ce7aa0e1b2ULL, 0x7343efebd1940993ULL},
+    {0xa1ebfb4219491a1fULL, 0x1014ebe6c5f90bf8ULL},
+    {0xca66fa129f9b60a6ULL, 0xd41a26e077774ef6ULL},
+    {0xfd00b897478238d0ULL, 0x8920b098955522b4ULL},
+    {0x9e20735e8cb16382ULL, 0x55b46e5f5d5535b0ULL},
+    {0xc5a890362fddbc62ULL, 0xeb2189f734aa831dULL},
+    {0xf712b443bbd52b7bULL, 0xa5e9ec7501d523e4ULL},
+    {0x9a6bb0aa55653b2dULL, 0x47b233c92125366eULL},
+    {0xc1069cd4eabe89f8ULL, 0x999ec0bb696e840aULL},
+    {0xf148440a256e2c76ULL, 0xc00670ea43ca250dULL},
+    {0x96cd2a865764dbcaULL, 0x380406926a5e5728ULL},
+    {0xbc807527ed3e12bcULL, 0xc605083704f5ecf2ULL},
+    {0xeba09271e88d976bULL, 0xf7864a44c633682eULL},
+    {0x93445b8731587ea3ULL, 0x7ab3ee6afbe0211dULL},
+    {0xb8157268fdae9e4cULL, 0x5960ea05bad82964ULL},
+    {0xe61acf033d1a45dfULL, 0x6fb92487298e33bdULL},
+    {0x8fd0c16206306babULL, 0xa5d3b6d479f8e056ULL},
+    {0xb3c4f1ba87bc8696ULL, 0x8f48a4899877186cULL},
+    {0xe0b62e2929aba83cULL, 0x331acdabfe94de87ULL},
+    {0x8c71dcd9ba0b4925ULL, 0x9ff0c08b7f1d0b14ULL},
+    {0xaf8e5410288e1b6fULL, 0x07ecf0ae5ee44dd9ULL},
+    {0xdb71e91432b1a24aULL, 0xc9e82cd9f69d6150ULL},
+    {0x892731ac9faf056eULL, 0xbe311c083a225cd2ULL},
+    {0xab70fe17c79ac6caULL, 0x6dbd630a48aaf406ULL},
+    {0xd64d3d9db981787dULL, 0x092cbbccdad5b108ULL},
+    {0x85f0468293f0eb4eULL, 0x25bbf56008c58ea5ULL},
+    {0xa76c582338ed2621ULL, 0xaf2af2b80af6f24eULL},
+    {0xd1476e2c07286faaULL, 0x1af5af660db4aee1ULL},
+    {0x82cca4db847945caULL, 0x50d98d9fc890ed4dULL},
+    {0xa37fce126597973cULL, 0xe50ff107bab528a0ULL},
+    {0xcc5fc196fefd7d0cULL, 0x1e53ed49a96272c8ULL},
+    {0xff77b1fcbebcdc4fULL, 0x25e8e89c13bb0f7aULL},
+    {0x9faacf3df73609b1ULL, 0x77b191618c54e9acULL},
+    {0xc795830d75038c1dULL, 0xd59df5b9ef6a2417ULL},
+    {0xf97ae3d0d2446f25ULL, 0x4b0573286b44ad1dULL},
+    {0x9becce62836ac577ULL, 0x4ee367f9430aec32ULL},
+    {0xc2e801fb244576d5ULL, 0x229c41f793cda73fULL},
+    {0xf3a20279ed56d48aULL, 0x6b43527578c1110fULL},
+    {0x9845418c345644d6ULL, 0x830a13896b78aaa9ULL},
+    {0xbe5691ef416bd60cULL, 0x23cc986bc656d553ULL},
+    {0xedec366b11c6cb8fULL, 0x2cbfbe86b7ec8aa8ULL},
+    {0x94b3a202eb1c3f39ULL, 0x7bf7d71432f3d6a9ULL},
+    {0xb9e08a83a5e34f07ULL, 0xdaf5ccd93fb0cc53ULL},
+    {0xe858ad248f5c22c9ULL, 0xd1b3400f8f9cff68ULL},
+    {0x91376c36d99995beULL, 0x23100809b9c21fa1ULL},
+    {0xb58547448ffffb2dULL, 0xabd40a0c2832a78aULL},
+    {0xe2e69915b3fff9f9ULL, 0x16c90c8f323f516cULL},
+    {0x8dd01fad907ffc3bULL, 0xae3da7d97f6792e3ULL},
+    {0xb1442798f49ffb4aULL, 0x99cd11cfdf41779cULL},
+    {0xdd95317f31c7fa1dULL, 0x40405643d711d583ULL},
+    {0x8a7d3eef7f1cfc52ULL, 0x482835ea666b2572ULL},
+    {0xad1c8eab5ee43b66ULL, 0xda3243650005eecfULL},
+    {0xd863b256369d4a40ULL, 0x90bed43e40076a82ULL},
+    {0x873e4f75e2224e68ULL, 0x5a7744a6e804a291ULL},
+    {0xa90de3535aaae202ULL, 0x711515d0a205cb36ULL},
+    {0xd3515c2831559a83ULL, 0x0d5a5b44ca873e03ULL},
+    {0x8412d9991ed58091ULL, 0xe858790afe9486c2ULL},
+    {0xa5178fff668ae0b6ULL, 0x626e974dbe39a872ULL},
+    {0xce5d73ff402d98e3ULL, 0xfb0a3d212dc8128fULL},
+    {0x80fa687f881c7f8eULL, 0x7ce66634bc9d0b99ULL},
+    {0xa139029f6a239f72ULL, 0x1c1fffc1ebc44e80ULL},
+    {0xc987434744ac874eULL, 0xa327ffb266b56220ULL},
+    {0xfbe9141915d7a922ULL, 0x4bf1ff9f0062baa8ULL},
+    {0x9d71ac8fada6c9b5ULL, 0x6f773fc3603db4a9ULL},
+    {0xc4ce17b399107c22ULL, 0xcb550fb4384d21d3ULL},
+    {0xf6019da07f549b2bULL, 0x7e2a53a146606a48ULL},
+    {0x99c102844f94e0fbULL, 0x2eda7444cbfc426dULL},
+    {0xc0314325637a1939ULL, 0xfa911155fefb5308ULL},
+    {0xf03d93eebc589f88ULL, 0x793555ab7eba27caULL},
+    {0x96267c7535b763b5ULL, 0x4bc1558b2f3458deULL},
+    {0xbbb01b9283253ca2ULL, 0x9eb1aaedfb016f16ULL},
+    {0xea9c227723ee8bcbULL, 0x465e15a979c1cadcULL},
+    {0x92a1958a7675175fULL, 0x0bfacd89ec191ec9ULL},
+    {0xb749faed14125d36ULL, 0xcef980ec671f667bULL},
+    {0xe51c79a85916f484ULL, 0x82b7e12780e7401aULL},
+    {0x8f31cc0937ae58d2ULL, 0xd1b2ecb8b0908810ULL},
+    {0xb2fe3f0b8599ef07ULL, 0x861fa7e6dcb4aa15ULL},
+    {0xdfbdcece67006ac9ULL, 0x67a791e093e1d49aULL},
+    {0x8bd6a141006042bdULL, 0xe0c8bb2c5c6d24e0ULL},
+    {0xaecc49914078536dULL, 0x58fae9f773886e18ULL},
+    {0xda7f5bf590966848ULL, 0xaf39a475506a899eULL},
+    {0x888f99797a5e012dULL, 0x6d8406c952429603ULL},
+    {0xaab37fd7d8f58178ULL, 0xc8e5087ba6d33b83ULL},
+    {0xd5605fcdcf32e1d6ULL, 0xfb1e4a9a90880a64ULL},
+    {0x855c3be0a17fcd26ULL, 0x5cf2eea09a55067fULL},
+    {0xa6b34ad8c9dfc06fULL, 0xf42faa48c0ea481eULL},
+    {0xd0601d8efc57b08bULL, 0xf13b94daf124da26ULL},
+    {0x823c12795db6ce57ULL, 0x76c53d08d6b70858ULL},
+    {0xa2cb1717b52481edULL, 0x54768c4b0c64ca6eULL},
+    {0xcb7ddcdda26da268ULL, 0xa9942f5dcf7dfd09ULL},
+    {0xfe5d54150b090b02ULL, 0xd3f93b35435d7c4cULL},
+    {0x9efa548d26e5a6e1ULL, 0xc47bc5014a1a6dafULL},
+    {0xc6b8e9b0709f109aULL, 0x359ab6419ca1091bULL},
+    {0xf867241c8cc6d4c0ULL, 0xc30163d203c94b62ULL},
+    {0x9b407691d7fc44f8ULL, 0x79e0de63425dcf1dULL},
+    {0xc21094364dfb5636ULL, 0x985915fc12f542e4ULL},
+    {0xf294b943e17a2bc4ULL, 0x3e6f5b7b17b2939dULL},
+    {0x979cf3ca6cec5b5aULL, 0xa705992ceecf9c42ULL},
+    {0xbd8430bd08277231ULL, 0x50c6ff782a838353ULL},
+    {0xece53cec4a314ebdULL, 0xa4f8bf5635246428ULL},
+    {0x940f4613ae5ed136ULL, 0x871b7795e136be99ULL},
+    {0xb913179899f68584ULL, 0x28e2557b59846e3fULL},
+    {0xe757dd7ec07426e5ULL, 0x331aeada2fe589cfULL},
+    {0x9096ea6f3848984fULL, 0x3ff0d2c85def7621ULL},
+    {0xb4bca50b065abe63ULL, 0x0fed077a756b53a9ULL},
+    {0xe1ebce4dc7f16dfbULL, 0xd3e8495912c62894ULL},
+    {0x8d3360f09cf6e4bdULL, 0x64712dd7abbbd95cULL},
+    {0xb080392cc4349decULL, 0xbd8d794d96aacfb3ULL},
+    {0xdca04777f541c567ULL, 0xecf0d7a0fc5583a0ULL},
+    {0x89e42caaf9491b60ULL, 0xf41686c49db57244ULL},
+    {0xac5d37d5b79b6239ULL, 0x311c2875c522ced5ULL},
+    {0xd77485cb25823ac7ULL, 0x7d633293366b828bULL},
+    {0x86a8d39ef77164bcULL, 0xae5dff9c02033197ULL},
+    {0xa8530886b54dbdebULL, 0xd9f57f830283fdfcULL},
+    {0xd267caa862a12d66ULL, 0xd072df63c324fd7bULL},
+    {0x8380dea93da4bc60ULL, 0x4247cb9e59f71e6dULL},
+    {0xa46116538d0deb78ULL, 0x52d9be85f074e608ULL},
+    {0xcd795be870516656ULL, 0x67902e276c921f8bULL},
+    {0x806bd9714632dff6ULL, 0x00ba1cd8a3db53b6ULL},
+    {0xa086cfcd97bf97f3ULL, 0x80e8a40eccd228a4ULL},
+    {0xc8a883c0fdaf7df0ULL, 0x6122cd128006b2cdULL},
+    {0xfad2a4b13d1b5d6cULL, 0x796b805720085f81ULL},
+    {0x9cc3a6eec6311a63ULL, 0xcbe3303674053bb0ULL},
+    {0xc3f490aa77bd60fcULL, 0xbedbfc4411068a9cULL},
+    {0xf4f1b4d515acb93bULL, 0xee92fb5515482d44ULL},
+    {0x991711052d8bf3c5ULL, 0x751bdd152d4d1c4aULL},
+    {0xbf5cd54678eef0b6ULL, 0xd262d45a78a0635dULL},
+    {0xef340a98172aace4ULL, 0x86fb897116c87c34ULL},
+    {0x9580869f0e7aac0eULL, 0xd45d35e6ae3d4da0ULL},
+    {0xbae0a846d2195712ULL, 0x8974836059cca109ULL},
+    {0xe998d258869facd7ULL, 0x2bd1a438703fc94bULL},
+    {0x91ff83775423cc06ULL, 0x7b6306a34627ddcfULL},
+    {0xb67f6455292cbf08ULL, 0x1a3bc84c17b1d542ULL},
+    {0xe41f3d6a7377eecaULL, 0x20caba5f1d9e4a93ULL},
+    {0x8e938662882af53eULL, 0x547eb47b7282ee9cULL},
+    {0xb23867fb2a35b28dULL, 0xe99e619a4f23aa43ULL},
+    {0xdec681f9f4c31f31ULL, 0x6405fa00e2ec94d4ULL},
+    {0x8b3c113c38f9f37eULL, 0xde83bc408dd3dd04ULL},
+    {0xae0b158b4738705eULL, 0x9624ab50b148d445ULL},
+    {0xd98ddaee19068c76ULL, 0x3badd624dd9b0957ULL},
+    {0x87f8a8d4cfa417c9ULL, 0xe54ca5d70a80e5d6ULL},
+    {0xa9f6d30a038d1dbcULL, 0x5e9fcf4ccd211f4cULL},
+    {0xd47487cc8470652bULL, 0x7647c3200069671fULL},
+    {0x84c8d4dfd2c63f3bULL, 0x29ecd9f40041e073ULL},
+    {0xa5fb0a17c777cf09ULL, 0xf468107100525890ULL},
+    {0xcf79cc9db955c2ccULL, 0x7182148d4066eeb4ULL},
+    {0x81ac1fe293d599bfULL, 0xc6f14cd848405530ULL},
+    {0xa21727db38cb002fULL, 0xb8ada00e5a506a7cULL},
+    {0xca9cf1d206fdc03bULL, 0xa6d90811f0e4851cULL},
+    {0xfd442e4688bd304aULL, 0x908f4a166d1da663ULL},
+    {0x9e4a9cec15763e2eULL, 0x9a598e4e043287feULL},
+    {0xc5dd44271ad3cdbaULL, 0x40eff1e1853f29fdULL},
+    {0xf7549530e188c128ULL, 0xd12bee59e68ef47cULL},
+    {0x9a94dd3e8cf578b9ULL, 0x82bb74f8301958ceULL},
+    {0xc13a148e3032d6e7ULL, 0xe36a52363c1faf01ULL},
+    {0xf18899b1bc3f8ca1ULL, 0xdc44e6c3cb279ac1ULL},
+    {0x96f5600f15a7b7e5ULL, 0x29ab103a5ef8c0b9ULL},
+    {0xbcb2b812db11a5deULL, 0x7415d448f6b6f0e7ULL},
+    {0xebdf661791d60f56ULL, 0x111b495b3464ad21ULL},
+    {0x936b9fcebb25c995ULL, 0xcab10dd900beec34ULL},
+    {0xb84687c269ef3bfbULL, 0x3d5d514f40eea742ULL},
+    {0xe65829b3046b0afaULL, 0x0cb4a5a3112a5112ULL},
+    {0x8ff71a0fe2c2e6dcULL, 0x47f0e785eaba72abULL},
+    {0xb3f4e093db73a093ULL, 0x59ed216765690f56ULL},
+    {0xe0f218b8d25088b8ULL, 0x306869c13ec3532cULL},
+    {0x8c974f7383725573ULL, 0x1e414218c73a13fbULL},
+    {0xafbd2350644eeacfULL, 0xe5d1929ef90898faULL},
+    {0xdbac6c247d62a583ULL, 0xdf45f746b74abf39ULL},
+    {0x894bc396ce5da772ULL, 0x6b8bba8c328eb783ULL},
+    {0xab9eb47c81f5114fULL, 0x066ea92f3f326564ULL},
+    {0xd686619ba27255a2ULL, 0xc80a537b0efefebdULL},
+    {0x8613fd0145877585ULL, 0xbd06742ce95f5f36ULL},
+    {0xa798fc4196e952e7ULL, 0x2c48113823b73704ULL},
+    {0xd17f3b51fca3a7a0ULL, 0xf75a15862ca504c5ULL},
+    {0x82ef85133de648c4ULL, 0x9a984d73dbe722fbULL},
+    {0xa3ab66580d5fdaf5ULL, 0xc13e60d0d2e0ebbaULL},
+    {0xcc963fee10b7d1b3ULL, 0x318df905079926a8ULL},
+    {0xffbbcfe994e5c61fULL, 0xfdf17746497f7052ULL},
+    {0x9fd561f1fd0f9bd3ULL, 0xfeb6ea8bedefa633ULL},
+    {0xc7caba6e7c5382c8ULL, 0xfe64a52ee96b8fc0ULL},
+    {0xf9bd690a1b68637bULL, 0x3dfdce7aa3c673b0ULL},
+    {0x9c1661a651213e2dULL, 0x06bea10ca65c084eULL},
+    {0xc31bfa0fe5698db8ULL, 0x486e494fcff30a62ULL},
+    {0xf3e2f893dec3f126ULL, 0x5a89dba3c3efccfaULL},
+    {0x986ddb5c6b3a76b7ULL, 0xf89629465a75e01cULL},
+    {0xbe89523386091465ULL, 0xf6bbb397f1135823ULL},
+    {0xee2ba6c0678b597fULL, 0x746aa07ded582e2cULL},
+    {0x94db483840b717efULL, 0xa8c2a44eb4571cdcULL},
+    {0xba121a4650e4ddebULL, 0x92f34d62616ce413ULL},
+    {0xe896a0d7e51e1566ULL, 0x77b020baf9c81d17ULL},
+    {0x915e2486ef32cd60ULL, 0x0ace1474dc1d122eULL},
+    {0xb5b5ada8aaff80b8ULL, 0x0d819992132456baULL},
+    {0xe3231912d5bf60e6ULL, 0x10e1fff697ed6c69ULL},
+    {0x8df5efabc5979c8fULL, 0xca8d3ffa1ef463c1ULL},
+    {0xb1736b96b6fd83b3ULL, 0xbd308ff8a6b17cb2ULL},
+    {0xddd0467c64bce4a0ULL, 0xac7cb3f6d05ddbdeULL},
+    {0x8aa22c0dbef60ee4ULL, 0x6bcdf07a423aa96bULL},
+    {0xad4ab7112eb3929dULL, 0x86c16c98d2c953c6ULL},
+    {0xd89d64d57a607744ULL, 0xe871c7bf077ba8b7ULL},
+    {0x87625f056c7c4a8bULL, 0x11471cd764ad4972ULL},
+    {0xa93af6c6c79b5d2dULL, 0xd598e40d3dd89bcfULL},
+    {0xd389b47879823479ULL, 0x4aff1d108d4ec2c3ULL},
+    {0x843610cb4bf160cbULL, 0xcedf722a585139baULL},
+    {0xa54394fe1eedb8feULL, 0xc2974eb4ee658828ULL},
+    {0xce947a3da6a9273eULL, 0x733d226229feea32ULL},
+    {0x811ccc668829b887ULL, 0x0806357d5a3f525fULL},
+    {0xa163ff802a3426a8ULL, 0xca07c2dcb0cf26f7ULL},
+    {0xc9bcff6034c13052ULL, 0xfc89b393dd02f0b5ULL},
+    {0xfc2c3f3841f17c67ULL, 0xbbac2078d443ace2ULL},
+    {0x9d9ba7832936edc0ULL, 0xd54b944b84aa4c0dULL},
+    {0xc5029163f384a931ULL, 0x0a9e795e65d4df11ULL},
+    {0xf64335bcf065d37dULL, 0x4d4617b5ff4a16d5ULL},
+    {0x99ea0196163fa42eULL, 0x504bced1bf8e4e45ULL},
+    {0xc06481fb9bcf8d39ULL, 0xe45ec2862f71e1d6ULL},
+    {0xf07da27a82c37088ULL, 0x5d767327bb4e5a4cULL},
+    {0x964e858c91ba2655ULL, 0x3a6a07f8d510f86fULL},
+    {0xbbe226efb628afeaULL, 0x890489f70a55368bULL},
+    {0xeadab0aba3b2dbe5ULL, 0x2b45ac74ccea842eULL},
+    {0x92c8ae6b464fc96fULL, 0x3b0b8bc90012929dULL},
+    {0xb77ada0617e3bbcbULL, 0x09ce6ebb40173744ULL},
+    {0xe55990879ddcaabdULL, 0xcc420a6a101d0515ULL},
+    {0x8f57fa54c2a9eab6ULL, 0x9fa946824a12232dULL},
+    {0xb32df8e9f3546564ULL, 0x47939822dc96abf9ULL},
+    {0xdff9772470297ebdULL, 0x59787e2b93bc56f7ULL},
+    {0x8bfbea76c619ef36ULL, 0x57eb4edb3c55b65aULL},
+    {0xaefae51477a06b03ULL, 0xede622920b6b23f1ULL},
+    {0xdab99e59958885c4ULL, 0xe95fab368e45ecedULL},
+    {0x88b402f7fd75539bULL, 0x11dbcb0218ebb414ULL},
+    {0xaae103b5fcd2a881ULL, 0xd652bdc29f26a119ULL},
+    {0xd59944a37c0752a2ULL, 0x4be76d3346f0495fULL},
+    {0x857fcae62d8493a5ULL, 0x6f70a4400c562ddbULL},
+    {0xa6dfbd9fb8e5b88eULL, 0xcb4ccd500f6bb952ULL},
+    {0xd097ad07a71f26b2ULL, 0x7e2000a41346a7a7ULL},
+    {0x825ecc24c873782fULL, 0x8ed400668c0c28c8ULL},
+    {0xa2f67f2dfa90563bULL, 0x728900802f0f32faULL},
+    {0xcbb41ef979346bcaULL, 0x4f2b40a03ad2ffb9ULL},
+    {0xfea126b7d78186bcULL, 0xe2f610c84987bfa8ULL},
+    {0x9f24b832e6b0f436ULL, 0x0dd9ca7d2df4d7c9ULL},
+    {0xc6ede63fa05d3143ULL, 0x91503d1c79720dbbULL},
+    {0xf8a95fcf88747d94ULL, 0x75a44c6397ce912aULL},
+    {0x9b69dbe1b548ce7cULL, 0xc986afbe3ee11abaULL},
+    {0xc24452da229b021bULL, 0xfbe85badce996168ULL},
+    {0xf2d56790ab41c2a2ULL, 0xfae27299423fb9c3ULL},
+    {0x97c560ba6b0919a5ULL, 0xdccd879fc967d41aULL},
+    {0xbdb6b8e905cb600fULL, 0x5400e987bbc1c920ULL},
+    {0xed246723473e3813ULL, 0x290123e9aab23b68ULL},
+    {0x9436c0760c86e30bULL, 0xf9a0b6720aaf6521ULL},
+    {0xb94470938fa89bceULL, 0xf808e40e8d5b3e69ULL},
+    {0xe7958cb87392c2c2ULL, 0xb60b1d1230b20e04ULL},
+    {0x90bd77f3483bb9b9ULL, 0xb1c6f22b5e6f48c2ULL},
+    {0xb4ecd5f01a4aa828ULL, 0x1e38aeb6360b1af3ULL},
+    {0xe2280b6c20dd5232ULL, 0x25c6da63c38de1b0ULL},
+    {0x8d590723948a535fULL, 0x579c487e5a38ad0eULL},
+    {0xb0af48ec79ace837ULL, 0x2d835a9df0c6d851ULL},
+    {0xdcdb1b2798182244ULL, 0xf8e431456cf88e65ULL},
+    {0x8a08f0f8bf0f156bULL, 0x1b8e9ecb641b58ffULL},
+    {0xac8b2d36eed2dac5ULL, 0xe272467e3d222f3fULL},
+    {0xd7adf884aa879177ULL, 0x5b0ed81dcc6abb0fULL},
+    {0x86ccbb52ea94baeaULL, 0x98e947129fc2b4e9ULL},
+    {0xa87fea27a539e9a5ULL, 0x3f2398d747b36224ULL},
+    {0xd29fe4b18e88640eULL, 0x8eec7f0d19a03aadULL},
+    {0x83a3eeeef9153e89ULL, 0x1953cf68300424acULL},
+    {0xa48ceaaab75a8e2bULL, 0x5fa8c3423c052dd7ULL},
+    {0xcdb02555653131b6ULL, 0x3792f412cb06794dULL},
+    {0x808e17555f3ebf11ULL, 0xe2bbd88bbee40bd0ULL},
+    {0xa0b19d2ab70e6ed6ULL, 0x5b6aceaeae9d0ec4ULL},
+    {0xc8de047564d20a8bULL, 0xf245825a5a445275ULL},
+    {0xfb158592be068d2eULL, 0xeed6e2f0f0d56712ULL},
+    {0x9ced737bb6c4183dULL, 0x55464dd69685606bULL},
+    {0xc428d05aa4751e4cULL, 0xaa97e14c3c26b886ULL},
+    {0xf53304714d9265dfULL, 0xd53dd99f4b3066a8ULL},
+    {0x993fe2c6d07b7fabULL, 0xe546a8038efe4029ULL},
+    {0xbf8fdb78849a5f96ULL, 0xde98520472bdd033ULL},
+    {0xef73d256a5c0f77cULL, 0x963e66858f6d4440ULL},
+    {0x95a8637627989aadULL, 0xdde7001379a44aa8ULL},
+    {0xbb127c53b17ec159ULL, 0x5560c018580d5d52ULL},
+    {0xe9d71b689dde71afULL, 0xaab8f01e6e10b4a6ULL},
+    {0x9226712162ab070dULL, 0xcab3961304ca70e8ULL},
+    {0xb6b00d69bb55c8d1ULL, 0x3d607b97c5fd0d22ULL},
+    {0xe45c10c42a2b3b05ULL, 0x8cb89a7db77c506aULL},
+    {0x8eb98a7a9a5b04e3ULL, 0x77f3608e92adb242ULL},
+    {0xb267ed1940f1c61cULL, 0x55f038b237591ed3ULL},
+    {0xdf01e85f912e37a3ULL, 0x6b6c46dec52f6688ULL},
+    {0x8b61313bbabce2c6ULL, 0x2323ac4b3b3da015ULL},
+    {0xae397d8aa96c1b77ULL, 0xabec975e0a0d081aULL},
+    {0xd9c7dced53c72255ULL, 0x96e7bd358c904a21ULL},
+    {0x881cea14545c7575ULL, 0x7e50d64177da2e54ULL},
+    {0xaa242499697392d2ULL, 0xdde50bd1d5d0b9e9ULL},
+    {0xd4ad2dbfc3d07787ULL, 0x955e4ec64b44e864ULL},
+    {0x84ec3c97da624ab4ULL, 0xbd5af13bef0b113eULL},
+    {0xa6274bbdd0fadd61ULL, 0xecb1ad8aeacdd58eULL},
+    {0xcfb11ead453994baULL, 0x67de18eda5814af2ULL},
+    {0x81ceb32c4b43fcf4ULL, 0x80eacf948770ced7ULL},
+    {0xa2425ff75e14fc31ULL, 0xa1258379a94d028dULL},
+    {0xcad2f7f5359a3b3eULL, 0x096ee45813a04330ULL},
+    {0xfd87b5f28300ca0dULL, 0x8bca9d6e188853fcULL},
+    {0x9e74d1b791e07e48ULL, 0x775ea264cf55347eULL},
+    {0xc612062576589ddaULL, 0x95364afe032a819eULL},
+    {0xf79687aed3eec551ULL, 0x3a83ddbd83f52205ULL},
+    {0x9abe14cd44753b52ULL, 0xc4926a9672793543ULL},
+    {0xc16d9a0095928a27ULL, 0x75b7053c0f178294ULL},
+    {0xf1c90080baf72cb1ULL, 0x5324c68b12dd6339ULL},
+    {0x971da05074da7beeULL, 0xd3f6fc16ebca5e04ULL},
+    {0xbce5086492111aeaULL, 0x88f4bb1ca6bcf585ULL},
+    {0xec1e4a7db69561a5ULL, 0x2b31e9e3d06c32e6ULL},
+    {0x9392ee8e921d5d07ULL, 0x3aff322e62439fd0ULL},
+    {0xb877aa3236a4b449ULL, 0x09befeb9fad487c3ULL},
+    {0xe69594bec44de15bULL, 0x4c2ebe687989a9b4ULL},
+    {0x901d7cf73ab0acd9ULL, 0x0f9d37014bf60a11ULL},
+    {0xb424dc35095cd80fULL, 0x538484c19ef38c95ULL},
+    {0xe12e13424bb40e13ULL, 0x2865a5f206b06fbaULL},
+    {0x8cbccc096f5088cbULL, 0xf93f87b7442e45d4ULL},
+    {0xafebff0bcb24aafeULL, 0xf78f69a51539d749ULL},
+    {0xdbe6fecebdedd5beULL, 0xb573440e5a884d1cULL},
+    {0x89705f4136b4a597ULL, 0x31680a88f8953031ULL},
+    {0xabcc77118461cefcULL, 0xfdc20d2b36ba7c3eULL},
+    {0xd6bf94d5e57a42bcULL, 0x3d32907604691b4dULL},
+    {0x8637bd05af6c69b5ULL, 0xa63f9a49c2c1b110ULL},
+    {0xa7c5ac471b478423ULL, 0x0fcf80dc33721d54ULL},
+    {0xd1b71758e219652bULL, 0xd3c36113404ea4a9ULL},
+    {0x83126e978d4fdf3bULL, 0x645a1cac083126eaULL},
+    {0xa3d70a3d70a3d70aULL, 0x3d70a3d70a3d70a4ULL},
+    {0xccccccccccccccccULL, 0xcccccccccccccccdULL},
+    {0x8000000000000000ULL, 0x0000000000000000ULL},
+    {0xa000000000000000ULL, 0x0000000000000000ULL},
+    {0xc800000000000000ULL, 0x0000000000000000ULL},
+    {0xfa00000000000000ULL, 0x0000000000000000ULL},
+    {0x9c40000000000000ULL, 0x0000000000000000ULL},
+    {0xc350000000000000ULL, 0x0000000000000000ULL},
+    {0xf424000000000000ULL, 0x0000000000000000ULL},
+    {0x9896800000000000ULL, 0x0000000000000000ULL},
+    {0xbebc200000000000ULL, 0x0000000000000000ULL},
+    {0xee6b280000000000ULL, 0x0000000000000000ULL},
+    {0x9502f90000000000ULL, 0x0000000000000000ULL},
+    {0xba43b74000000000ULL, 0x0000000000000000ULL},
+    {0xe8d4a51000000000ULL, 0x0000000000000000ULL},
+    {0x9184e72a00000000ULL, 0x0000000000000000ULL},
+    {0xb5e620f480000000ULL, 0x0000000000000000ULL},
+    {0xe35fa931a0000000ULL, 0x0000000000000000ULL},
+    {0x8e1bc9bf04000000ULL, 0x0000000000000000ULL},
+    {0xb1a2bc2ec5000000ULL, 0x0000000000000000ULL},
+    {0xde0b6b3a76400000ULL, 0x0000000000000000ULL},
+    {0x8ac7230489e80000ULL, 0x0000000000000000ULL},
+    {0xad78ebc5ac620000ULL, 0x0000000000000000ULL},
+    {0xd8d726b7177a8000ULL, 0x0000000000000000ULL},
+    {0x878678326eac9000ULL, 0x0000000000000000ULL},
+    {0xa968163f0a57b400ULL, 0x0000000000000000ULL},
+    {0xd3c21bcecceda100ULL, 0x0000000000000000ULL},
+    {0x84595161401484a0ULL, 0x0000000000000000ULL},
+    {0xa56fa5b99019a5c8ULL, 0x0000000000000000ULL},
+    {0xcecb8f27f4200f3aULL, 0x0000000000000000ULL},
+    {0x813f3978f8940984ULL, 0x4000000000000000ULL},
+    {0xa18f07d736b90be5ULL, 0x5000000000000000ULL},
+    {0xc9f2c9cd04674edeULL, 0xa400000000000000ULL},
+    {0xfc6f7c4045812296ULL, 0x4d00000000000000ULL},
+    {0x9dc5ada82b70b59dULL, 0xf020000000000000ULL},
+    {0xc5371912364ce305ULL, 0x6c28000000000000ULL},
+    {0xf684df56c3e01bc6ULL, 0xc732000000000000ULL},
+    {0x9a130b963a6c115cULL, 0x3c7f400000000000ULL},
+    {0xc097ce7bc90715b3ULL, 0x4b9f100000000000ULL},
+    {0xf0bdc21abb48db20ULL, 0x1e86d40000000000ULL},
+    {0x96769950b50d88f4ULL, 0x1314448000000000ULL},
+    {0xbc143fa4e250eb31ULL, 0x17d955a000000000ULL},
+    {0xeb194f8e1ae525fdULL, 0x5dcfab0800000000ULL},
+    {0x92efd1b8d0cf37beULL, 0x5aa1cae500000000ULL},
+    {0xb7abc627050305adULL, 0xf14a3d9e40000000ULL},
+    {0xe596b7b0c643c719ULL, 0x6d9ccd05d0000000ULL},
+    {0x8f7e32ce7bea5c6fULL, 0xe4820023a2000000ULL},
+    {0xb35dbf821ae4f38bULL, 0xdda2802c8a800000ULL},
+    {0xe0352f62a19e306eULL, 0xd50b2037ad200000ULL},
+    {0x8c213d9da502de45ULL, 0x4526f422cc340000ULL},
+    {0xaf298d050e4395d6ULL, 0x9670b12b7f410000ULL},
+    {0xdaf3f04651d47b4cULL, 0x3c0cdd765f114000ULL},
+    {0x88d8762bf324cd0fULL, 0xa5880a69fb6ac800ULL},
+    {0xab0e93b6efee0053ULL, 0x8eea0d047a457a00ULL},
+    {0xd5d238a4abe98068ULL, 0x72a4904598d6d880ULL},
+    {0x85a36366eb71f041ULL, 0x47a6da2b7f864750ULL},
+    {0xa70c3c40a64e6c51ULL, 0x999090b65f67d924ULL},
+    {0xd0cf4b50cfe20765ULL, 0xfff4b4e3f741cf6dULL},
+    {0x82818f1281ed449fULL, 0xbff8f10e7a8921a4ULL},
+    {0xa321f2d7226895c7ULL, 0xaff72d52192b6a0dULL},
+    {0xcbea6f8ceb02bb39ULL, 0x9bf4f8a69f764490ULL},
+    {0xfee50b7025c36a08ULL, 0x02f236d04753d5b4ULL},
+    {0x9f4f2726179a2245ULL, 0x01d762422c946590ULL},
+    {0xc722f0ef9d80aad6ULL, 0x424d3ad2b7b97ef5ULL},
+    {0xf8ebad2b84e0d58bULL, 0xd2e0898765a7deb2ULL},
+    {0x9b934c3b330c8577ULL, 0x63cc55f49f88eb2fULL},
+    {0xc2781f49ffcfa6d5ULL, 0x3cbf6b71c76b25fbULL},
+    {0xf316271c7fc3908aULL, 0x8bef464e3945ef7aULL},
+    {0x97edd871cfda3a56ULL, 0x97758bf0e3cbb5acULL},
+    {0xbde94e8e43d0c8ecULL, 0x3d52eeed1cbea317ULL},
+    {0xed63a231d4c4fb27ULL, 0x4ca7aaa863ee4bddULL},
+    {0x945e455f24fb1cf8ULL, 0x8fe8caa93e74ef6aULL},
+    {0xb975d6b6ee39e436ULL, 0xb3e2fd538e122b44ULL},
+    {0xe7d34c64a9c85d44ULL, 0x60dbbca87196b616ULL},
+    {0x90e40fbeea1d3a4aULL, 0xbc8955e946fe31cdULL},
+    {0xb51d13aea4a488ddULL, 0x6babab6398bdbe41ULL},
+    {0xe264589a4dcdab14ULL, 0xc696963c7eed2dd1ULL},
+    {0x8d7eb76070a08aecULL, 0xfc1e1de5cf543ca2ULL},
+    {0xb0de65388cc8ada8ULL, 0x3b25a55f43294bcbULL},
+    {0xdd15fe86affad912ULL, 0x49ef0eb713f39ebeULL},
+    {0x8a2dbf142dfcc7abULL, 0x6e3569326c784337ULL},
+    {0xacb92ed9397bf996ULL, 0x49c2c37f07965404ULL},
+    {0xd7e77a8f87daf7fbULL, 0xdc33745ec97be906ULL},
+    {0x86f0ac99b4e8dafdULL, 0x69a028bb3ded71a3ULL},
+    {0xa8acd7c0222311bcULL, 0xc40832ea0d68ce0cULL},
+    {0xd2d80db02aabd62bULL, 0xf50a3fa490c30190ULL},
+    {0x83c7088e1aab65dbULL, 0x792667c6da79e0faULL},
+    {0xa4b8cab1a1563f52ULL, 0x577001b891185938ULL},
+    {0xcde6fd5e09abcf26ULL, 0xed4c0226b55e6f86ULL},
+    {0x80b05e5ac60b6178ULL, 0x544f8158315b05b4ULL},
+    {0xa0dc75f1778e39d6ULL, 0x696361ae3db1c721ULL},
+    {0xc913936dd571c84cULL, 0x03bc3a19cd1e38e9ULL},
+    {0xfb5878494ace3a5fULL, 0x04ab48a04065c723ULL},
+    {0x9d174b2dcec0e47bULL, 0x62eb0d64283f9c76ULL},
+    {0xc45d1df942711d9aULL, 0x3ba5d0bd324f8394ULL},
+    {0xf5746577930d6500ULL, 0xca8f44ec7ee36479ULL},
+    {0x9968bf6abbe85f20ULL, 0x7e998b13cf4e1ecbULL},
+    {0xbfc2ef456ae276e8ULL, 0x9e3fedd8c321a67eULL},
+    {0xefb3ab16c59b14a2ULL, 0xc5cfe94ef3ea101eULL},
+    {0x95d04aee3b80ece5ULL, 0xbba1f1d158724a12ULL},
+    {0xbb445da9ca61281fULL, 0x2a8a6e45ae8edc97ULL},
+    {0xea1575143cf97226ULL, 0xf52d09d71a3293bdULL},
+    {0x924d692ca61be758ULL, 0x593c2626705f9c56ULL},
+    {0xb6e0c377cfa2e12eULL, 0x6f8b2fb00c77836cULL},
+    {0xe498f455c38b997aULL, 0x0b6dfb9c0f956447ULL},
+    {0x8edf98b59a373fecULL, 0x4724bd4189bd5eacULL},
+    {0xb2977ee300c50fe7ULL, 0x58edec91ec2cb657ULL},
+    {0xdf3d5e9bc0f653e1ULL, 0x2f2967b66737e3edULL},
+    {0x8b865b215899f46cULL, 0xbd79e0d20082ee74ULL},
+    {0xae67f1e9aec07187ULL, 0xecd8590680a3aa11ULL},
+    {0xda01ee641a708de9ULL, 0xe80e6f4820cc9495ULL},
+    {0x884134fe908658b2ULL, 0x3109058d147fdcddULL},
+    {0xaa51823e34a7eedeULL, 0xbd4b46f0599fd415ULL},
+    {0xd4e5e2cdc1d1ea96ULL, 0x6c9e18ac7007c91aULL},
+    {0x850fadc09923329eULL, 0x03e2cf6bc604ddb0ULL},
+    {0xa6539930bf6bff45ULL, 0x84db8346b786151cULL},
+    {0xcfe87f7cef46ff16ULL, 0xe612641865679a63ULL},
+    {0x81f14fae158c5f6eULL, 0x4fcb7e8f3f60c07eULL},
+    {0xa26da3999aef7749ULL, 0xe3be5e330f38f09dULL},
+    {0xcb090c8001ab551cULL, 0x5cadf5bfd3072cc5ULL},
+    {0xfdcb4fa002162a63ULL, 0x73d9732fc7c8f7f6ULL},
+    {0x9e9f11c4014dda7eULL, 0x2867e7fddcdd9afaULL},
+    {0xc646d63501a1511dULL, 0xb281e1fd541501b8ULL},
+    {0xf7d88bc24209a565ULL, 0x1f225a7ca91a4226ULL},
+    {0x9ae757596946075fULL, 0x3375788de9b06958ULL},
+    {0xc1a12d2fc3978937ULL, 0x0052d6b1641c83aeULL},
+    {0xf209787bb47d6b84ULL, 0xc0678c5dbd23a49aULL},
+    {0x9745eb4d50ce6332ULL, 0xf840b7ba963646e0ULL},
+    {0xbd176620a501fbffULL, 0xb650e5a93bc3d898ULL},
+    {0xec5d3fa8ce427affULL, 0xa3e51f138ab4cebeULL},
+    {0x93ba47c980e98cdfULL, 0xc66f336c36b10137ULL},
+    {0xb8a8d9bbe123f017ULL, 0xb80b0047445d4184ULL},
+    {0xe6d3102ad96cec1dULL, 0xa60dc059157491e5ULL},
+    {0x9043ea1ac7e41392ULL, 0x87c89837ad68db2fULL},
+    {0xb454e4a179dd1877ULL, 0x29babe4598c311fbULL},
+    {0xe16a1dc9d8545e94ULL, 0xf4296dd6fef3d67aULL},
+    {0x8ce2529e2734bb1dULL, 0x1899e4a65f58660cULL},
+    {0xb01ae745b101e9e4ULL, 0x5ec05dcff72e7f8fULL},
+    {0xdc21a1171d42645dULL, 0x76707543f4fa1f73ULL},
+    {0x899504ae72497ebaULL, 0x6a06494a791c53a8ULL},
+    {0xabfa45da0edbde69ULL, 0x0487db9d17636892ULL},
+    {0xd6f8d7509292d603ULL, 0x45a9d2845d3c42b6ULL},
+    {0x865b86925b9bc5c2ULL, 0x0b8a2392ba45a9b2ULL},
+    {0xa7f26836f282b732ULL, 0x8e6cac7768d7141eULL},
+    {0xd1ef0244af2364ffULL, 0x3207d795430cd926ULL},
+    {0x8335616aed761f1fULL, 0x7f44e6bd49e807b8ULL},
+    {0xa402b9c5a8d3a6e7ULL, 0x5f16206c9c6209a6ULL},
+    {0xcd036837130890a1ULL, 0x36dba887c37a8c0fULL},
+    {0x802221226be55a64ULL, 0xc2494954da2c9789ULL},
+    {0xa02aa96b06deb0fdULL, 0xf2db9baa10b7bd6cULL},
+    {0xc83553c5c8965d3dULL, 0x6f92829494e5acc7ULL},
+    {0xfa42a8b73abbf48cULL, 0xcb772339ba1f17f9ULL},
+    {0x9c69a97284b578d7ULL, 0xff2a760414536efbULL},
+    {0xc38413cf25e2d70dULL, 0xfef5138519684abaULL},
+    {0xf46518c2ef5b8cd1ULL, 0x7eb258665fc25d69ULL},
+    {0x98bf2f79d5993802ULL, 0xef2f773ffbd97a61ULL},
+    {0xbeeefb584aff8603ULL, 0xaafb550ffacfd8faULL},
+    {0xeeaaba2e5dbf6784ULL, 0x95ba2a53f983cf38ULL},
+    {0x952ab45cfa97a0b2ULL, 0xdd945a747bf26183ULL},
+    {0xba756174393d88dfULL, 0x94f971119aeef9e4ULL},
+    {0xe912b9d1478ceb17ULL, 0x7a37cd5601aab85dULL},
+    {0x91abb422ccb812eeULL, 0xac62e055c10ab33aULL},
+    {0xb616a12b7fe617aaULL, 0x577b986b314d6009ULL},
+    {0xe39c49765fdf9d94ULL, 0xed5a7e85fda0b80bULL},
+    {0x8e41ade9fbebc27dULL, 0x14588f13be847307ULL},
+    {0xb1d219647ae6b31cULL, 0x596eb2d8ae258fc8ULL},
+    {0xde469fbd99a05fe3ULL, 0x6fca5f8ed9aef3bbULL},
+    {0x8aec23d680043beeULL, 0x25de7bb9480d5854ULL},
+    {0xada72ccc20054ae9ULL, 0xaf561aa79a10ae6aULL},
+    {0xd910f7ff28069da4ULL, 0x1b2ba1518094da04ULL},
+    {0x87aa9aff79042286ULL, 0x90fb44d2f05d0842ULL},
+    {0xa99541bf57452b28ULL, 0x353a1607ac744a53ULL},
+    {0xd3fa922f2d1675f2ULL, 0x42889b8997915ce8ULL},
+    {0x847c9b5d7c2e09b7ULL, 0x69956135febada11ULL},
+    {0xa59bc234db398c25ULL, 0x43fab9837e699095ULL},
+    {0xcf02b2c21207ef2eULL, 0x94f967e45e03f4bbULL},
+    {0x8161afb94b44f57dULL, 0x1d1be0eebac278f5ULL},
+    {0xa1ba1ba79e1632dcULL, 0x6462d92a69731732ULL},
+    {0xca28a291859bbf93ULL, 0x7d7b8f7503cfdcfeULL},
+    {0xfcb2cb35e702af78ULL, 0x5cda735244c3d43eULL},
+    {0x9defbf01b061adabULL, 0x3a0888136afa64a7ULL},
+    {0xc56baec21c7a1916ULL, 0x088aaa1845b8fdd0ULL},
+    {0xf6c69a72a3989f5bULL, 0x8aad549e57273d45ULL},
+    {0x9a3c2087a63f6399ULL, 0x36ac54e2f678864bULL},
+    {0xc0cb28a98fcf3c7fULL, 0x84576a1bb416a7ddULL},
+    {0xf0fdf2d3f3c30b9fULL, 0x656d44a2a11c51d5ULL},
+    {0x969eb7c47859e743ULL, 0x9f644ae5a4b1b325ULL},
+    {0xbc4665b596706114ULL, 0x873d5d9f0dde1feeULL},
+    {0xeb57ff22fc0c7959ULL, 0xa90cb506d155a7eaULL},
+    {0x9316ff75dd87cbd8ULL, 0x09a7f12442d588f2ULL},
+    {0xb7dcbf5354e9beceULL, 0x0c11ed6d538aeb2fULL},
+    {0xe5d3ef282a242e81ULL, 0x8f1668c8a86da5faULL},
+    {0x8fa475791a569d10ULL, 0xf96e017d694487bcULL},
+    {0xb38d92d760ec4455ULL, 0x37c981dcc395a9acULL},
+    {0xe070f78d3927556aULL, 0x85bbe253f47b1417ULL},
+    {0x8c469ab843b89562ULL, 0x93956d7478ccec8eULL},
+    {0xaf58416654a6babbULL, 0x387ac8d1970027b2ULL},
+    {0xdb2e51bfe9d0696aULL, 0x06997b05fcc0319eULL},
+    {0x88fcf317f22241e2ULL, 0x441fece3bdf81f03ULL},
+    {0xab3c2fddeeaad25aULL, 0xd527e81cad7626c3ULL},
+    {0xd60b3bd56a5586f1ULL, 0x8a71e223d8d3b074ULL},
+    {0x85c7056562757456ULL, 0xf6872d5667844e49ULL},
+    {0xa738c6bebb12d16cULL, 0xb428f8ac016561dbULL},
+    {0xd106f86e69d785c7ULL, 0xe13336d701beba52ULL},
+    {0x82a45b450226b39cULL, 0xecc0024661173473ULL},
+    {0xa34d721642b06084ULL, 0x27f002d7f95d0190ULL},
+    {0xcc20ce9bd35c78a5ULL, 0x31ec038df7b441f4ULL},
+    {0xff290242c83396ceULL, 0x7e67047175a15271ULL},
+    {0x9f79a169bd203e41ULL, 0x0f0062c6e984d386ULL},
+    {0xc75809c42c684dd1ULL, 0x52c07b78a3e60868ULL},
+    {0xf92e0c3537826145ULL, 0xa7709a56ccdf8a82ULL},
+    {0x9bbcc7a142b17ccbULL, 0x88a66076400bb691ULL},
+    {0xc2abf989935ddbfeULL, 0x6acff893d00ea435ULL},
+    {0xf356f7ebf83552feULL, 0x0583f6b8c4124d43ULL},
+    {0x98165af37b2153deULL, 0xc3727a337a8b704aULL},
+    {0xbe1bf1b059e9a8d6ULL, 0x744f18c0592e4c5cULL},
+    {0xeda2ee1c7064130cULL, 0x1162def06f79df73ULL},
+    {0x9485d4d1c63e8be7ULL, 0x8addcb5645ac2ba8ULL},
+    {0xb9a74a0637ce2ee1ULL, 0x6d953e2bd7173692ULL},
+    {0xe8111c87c5c1ba99ULL, 0xc8fa8db6ccdd0437ULL},
+    {0x910ab1d4db9914a0ULL, 0x1d9c9892400a22a2ULL},
+    {0xb54d5e4a127f59c8ULL, 0x2503beb6d00cab4bULL},
+    {0xe2a0b5dc971f303aULL, 0x2e44ae64840fd61dULL},
+    {0x8da471a9de737e24ULL, 0x5ceaecfed289e5d2ULL},
+    {0xb10d8e1456105dadULL, 0x7425a83e872c5f47ULL},
+    {0xdd50f1996b947518ULL, 0xd12f124e28f77719ULL},
+    {0x8a5296ffe33cc92fULL, 0x82bd6b70d99aaa6fULL},
+    {0xace73cbfdc0bfb7bULL, 0x636cc64d1001550bULL},
+    {0xd8210befd30efa5aULL, 0x3c47f7e05401aa4eULL},
+    {0x8714a775e3e95c78ULL, 0x65acfaec34810a71ULL},
+    {0xa8d9d1535ce3b396ULL, 0x7f1839a741a14d0dULL},
+    {0xd31045a8341ca07cULL, 0x1ede48111209a050ULL},
+    {0x83ea2b892091e44dULL, 0x934aed0aab460432ULL},
+    {0xa4e4b66b68b65d60ULL, 0xf81da84d5617853fULL},
+    {0xce1de40642e3f4b9ULL, 0x36251260ab9d668eULL},
+    {0x80d2ae83e9ce78f3ULL, 0xc1d72b7c6b426019ULL},
+    {0xa1075a24e4421730ULL, 0xb24cf65b8612f81fULL},
+    {0xc94930ae1d529cfcULL, 0xdee033f26797b627ULL},
+    {0xfb9b7cd9a4a7443cULL, 0x169840ef017da3b1ULL},
+    {0x9d412e0806e88aa5ULL, 0x8e1f289560ee864eULL},
+    {0xc491798a08a2ad4eULL, 0xf1a6f2bab92a27e2ULL},
+    {0xf5b5d7ec8acb58a2ULL, 0xae10af696774b1dbULL},
+    {0x9991a6f3d6bf1765ULL, 0xacca6da1e0a8ef29ULL},
+    {0xbff610b0cc6edd3fULL, 0x17fd090a58d32af3ULL},
+    {0xeff394dcff8a948eULL, 0xddfc4b4cef07f5b0ULL},
+    {0x95f83d0a1fb69cd9ULL, 0x4abdaf101564f98eULL},
+    {0xbb764c4ca7a4440fULL, 0x9d6d1ad41abe37f1ULL},
+    {0xea53df5fd18d5513ULL, 0x84c86189216dc5edULL},
+    {0x92746b9be2f8552cULL, 0x32fd3cf5b4e49bb4ULL},
+    {0xb7118682dbb66a77ULL, 0x3fbc8c33221dc2a1ULL},
+    {0xe4d5e82392a40515ULL, 0x0fabaf3feaa5334aULL},
+    {0x8f05b1163ba6832dULL, 0x29cb4d87f2a7400eULL},
+    {0xb2c71d5bca9023f8ULL, 0x743e20e9ef511012ULL},
+    {0xdf78e4b2bd342cf6ULL, 0x914da9246b255416ULL},
+    {0x8bab8eefb6409c1aULL, 0x1ad089b6c2f7548eULL},
+    {0xae9672aba3d0c320ULL, 0xa184ac2473b529b1ULL},
+    {0xda3c0f568cc4f3e8ULL, 0xc9e5d72d90a2741eULL},
+    {0x8865899617fb1871ULL, 0x7e2fa67c7a658892ULL},
+    {0xaa7eebfb9df9de8dULL, 0xddbb901b98feeab7ULL},
+    {0xd51ea6fa85785631ULL, 0x552a74227f3ea565ULL},
+    {0x8533285c936b35deULL, 0xd53a88958f87275fULL},
+    {0xa67ff273b8460356ULL, 0x8a892abaf368f137ULL},
+    {0xd01fef10a657842cULL, 0x2d2b7569b0432d85ULL},
+    {0x8213f56a67f6b29bULL, 0x9c3b29620e29fc73ULL},
+    {0xa298f2c501f45f42ULL, 0x8349f3ba91b47b8fULL},
+    {0xcb3f2f7642717713ULL, 0x241c70a936219a73ULL},
+    {0xfe0efb53d30dd4d7ULL, 0xed238cd383aa0110ULL},
+    {0x9ec95d1463e8a506ULL, 0xf4363804324a40aaULL},
+    {0xc67bb4597ce2ce48ULL, 0xb143c6053edcd0d5ULL},
+    {0xf81aa16fdc1b81daULL, 0xdd94b7868e94050aULL},
+    {0x9b10a4e5e9913128ULL, 0xca7cf2b4191c8326ULL},
+    {0xc1d4ce1f63f57d72ULL, 0xfd1c2f611f63a3f0ULL},
+    {0xf24a01a73cf2dccfULL, 0xbc633b39673c8cecULL},
+    {0x976e41088617ca01ULL, 0xd5be0503e085d813ULL},
+    {0xbd49d14aa79dbc82ULL, 0x4b2d8644d8a74e18ULL},
+    {0xec9c459d51852ba2ULL, 0xddf8e7d60ed1219eULL},
+    {0x93e1ab8252f33b45ULL, 0xcabb90e5c942b503ULL},
+    {0xb8da1662e7b00a17ULL, 0x3d6a751f3b936243ULL},
+    {0xe7109bfba19c0c9dULL, 0x0cc512670a783ad4ULL},
+    {0x906a617d450187e2ULL, 0x27fb2b80668b24c5ULL},
+    {0xb484f9dc9641e9daULL, 0xb1f9f660802dedf6ULL},
+    {0xe1a63853bbd26451ULL, 0x5e7873f8a0396973ULL},
+    {0x8d07e33455637eb2ULL, 0xdb0b487b6423e1e8ULL},
+    {0xb049dc016abc5e5fULL, 0x91ce1a9a3d2cda62ULL},
+    {0xdc5c5301c56b75f7ULL, 0x7641a140cc7810fbULL},
+    {0x89b9b3e11b6329baULL, 0xa9e904c87fcb0a9dULL},
+    {0xac2820d9623bf429ULL, 0x546345fa9fbdcd44ULL},
+    {0xd732290fbacaf133ULL, 0xa97c177947ad4095ULL},
+    {0x867f59a9d4bed6c0ULL, 0x49ed8eabcccc485dULL},
+    {0xa81f301449ee8c70ULL, 0x5c68f256bfff5a74ULL},
+    {0xd226fc195c6a2f8cULL, 0x73832eec6fff3111ULL},
+    {0x83585d8fd9c25db7ULL, 0xc831fd53c5ff7eabULL},
+    {0xa42e74f3d032f525ULL, 0xba3e7ca8b77f5e55ULL},
+    {0xcd3a1230c43fb26fULL, 0x28ce1bd2e55f35ebULL},
+    {0x80444b5e7aa7cf85ULL, 0x7980d163cf5b81b3ULL},
+    {0xa0555e361951c366ULL, 0xd7e105bcc332621fULL},
+    {0xc86ab5c39fa63440ULL, 0x8dd9472bf3fefaa7ULL},
+    {0xfa856334878fc150ULL, 0xb14f98f6f0feb951ULL},
+    {0x9c935e00d4b9d8d2ULL, 0x6ed1bf9a569f33d3ULL},
+    {0xc3b8358109e84f07ULL, 0x0a862f80ec4700c8ULL},
+    {0xf4a642e14c6262c8ULL, 0xcd27bb612758c0faULL},
+    {0x98e7e9cccfbd7dbdULL, 0x8038d51cb897789cULL},
+    {0xbf21e44003acdd2cULL, 0xe0470a63e6bd56c3ULL},
+    {0xeeea5d5004981478ULL, 0x1858ccfce06cac74ULL},
+    {0x95527a5202df0ccbULL, 0x0f37801e0c43ebc8ULL},
+    {0xbaa718e68396cffdULL, 0xd30560258f54e6baULL},
+    {0xe950df20247c83fdULL, 0x47c6b82ef32a2069ULL},
+    {0x91d28b7416cdd27eULL, 0x4cdc331d57fa5441ULL},
+    {0xb6472e511c81471dULL, 0xe0133fe4adf8e952ULL},
+    {0xe3d8f9e563a198e5ULL, 0x58180fddd97723a6ULL},
+    {0x8e679c2f5e44ff8fULL, 0x570f09eaa7ea7648ULL},
+    {0xb201833b35d63f73ULL, 0x2cd2cc6551e513daULL},
+    {0xde81e40a034bcf4fULL, 0xf8077f7ea65e58d1ULL},
+    {0x8b112e86420f6191ULL, 0xfb04afaf27faf782ULL},
+    {0xadd57a27d29339f6ULL, 0x79c5db9af1f9b563ULL},
+    {0xd94ad8b1c7380874ULL, 0x18375281ae7822bcULL},
+    {0x87cec76f1c830548ULL, 0x8f2293910d0b15b5ULL},
+    {0xa9c2794ae3a3c69aULL, 0xb2eb3875504ddb22ULL},
+    {0xd433179d9c8cb841ULL, 0x5fa60692a46151ebULL},
+    {0x849feec281d7f328ULL, 0xdbc7c41ba6bcd333ULL},
+    {0xa5c7ea73224deff3ULL, 0x12b9b522906c0800ULL},
+    {0xcf39e50feae16befULL, 0xd768226b34870a00ULL},
+    {0x81842f29f2cce375ULL, 0xe6a1158300d46640ULL},
+    {0xa1e53af46f801c53ULL, 0x60495ae3c1097fd0ULL},
+    {0xca5e89b18b602368ULL, 0x385bb19cb14bdfc4ULL},
+    {0xfcf62c1dee382c42ULL, 0x46729e03dd9ed7b5ULL},
+    {0x9e19db92b4e31ba9ULL, 0x6c07a2c26a8346d1ULL},
+};
+
+// Eisel-Lemire: the binary64 nearest to w * 10^q, as the raw exponent and
+// mantissa fields in *out_bits (sign not included). Returns false when the
+// truncated 128-bit product cannot decide the rounding, which is rare enough
+// that the caller falls back to exact decimal arithmetic.
+// Lemire, "Number Parsing at a Gigabyte per Second" (2021).
+static inline bool
+sv_eisel_lemire_(int64_t q, uint64_t w, uint64_t *out_bits)
+{
+    if (w == 0 || q < SV_POW5_MIN_) { *out_bits = 0; return true; }
+    if (q > 308)          { *out_bits = (uint64_t)0x7FF << 52; return true; }
+
+    const unsigned lz = 63u - sv_msb64_(w);
+    w <<= lz;
+
+    // The top 55 bits of w * 5^q are all we need (mantissa, implicit bit,
+    // rounding bit and a bit lost to normalization). Refine with the low
+    // 64 bits of the table entry only if they could carry into them.
+    const uint64_t *pow5 = sv_pow5_128_[q - SV_POW5_MIN_];
+    uint64_t        hi;
+    uint64_t        lo = sv_mul128_(w, pow5[0], &hi);
+    if ((hi & 0x1FFu) == 0x1FFu) {
+        uint64_t hi2;
+        (void)sv_mul128_(w, pow5[1], &hi2);
+        lo += hi2;
+        if (hi2 > lo) hi += 1;
+        if (lo == UINT64_MAX && (q < -27 || q > 55)) return false;
+    }
+
+    const unsigned upper = (unsigned)(hi >> 63);
+    uint64_t       mantissa = hi >> (upper + 9);
+
+    // floor(q * log2(10)) + 63
+    int64_t power2 = sv_floor_shr_((152170 + 65536) * q, 16) + 63 + (int64_t)upper - (int64_t)lz + 1023;
+
+    if (power2 <= 0) {
+        // Subnormal, or zero once shifted past the last representable bit
+        if (-power2 + 1 >= 64) { *out_bits = 0; return true; }
+        mantissa >>= -power2 + 1;
+        mantissa  += mantissa & 1;
+        mantissa >>= 1;
+        // Rounding up can carry into the smallest normal
+        power2 = mantissa < ((uint64_t)1 << 52) ? 0 : 1;
+        *out_bits = ((uint64_t)power2 << 52) | (mantissa & (((uint64_t)1 << 52) - 1));
+        return true;
+    }
+
+    // Exactly halfway between two doubles: round to even instead of up.
+    // Only possible when 5^q is exact in 64 bits, i.e. q in [-4, 23].
+    if (lo <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1 &&
+        (mantissa << (upper + 9)) == hi) {
+        mantissa &= ~(uint64_t)1;
+    }
+
+    mantissa  += mantissa & 1;
+    mantissa >>= 1;
+    if (mantissa >= ((uint64_t)2 << 52)) {
+        mantissa = (uint64_t)1 << 52;
+        power2  += 1;
+    }
+    mantissa &= ~((uint64_t)1 << 52);
+
+    if (power2 >= 0x7FF) { *out_bits = (uint64_t)0x7FF << 52; return true; }
+    *out_bits = ((uint64_t)power2 << 52) | mantissa;
+    return true;
+}
+
+// Arbitrary-precision decimal for the inputs Eisel-Lemire cannot settle:
+// value = 0.d[0]d[1]...d[nd-1] * 10^dp with digits stored as 0..9. Digits past
+// the capacity only matter for breaking ties, so they are kept as a sticky
+// "truncated" flag. Shifting by powers of two and reading off 53 bits gives
+// the correctly rounded result (the "simple decimal conversion" algorithm).
+#define SV_DECIMAL_DIGITS_ 800
+#define SV_DECIMAL_SHIFT_  60
+
+typedef struct {
+    int32_t       nd;
+    int32_t       dp;
+    bool          truncated;
+    unsigned char d[SV_DECIMAL_DIGITS_];
+} SvDecimal_;
+
+static inline void
+sv_decimal_trim_(SvDecimal_ *a)
+{
+    while (a->nd > 0 && a->d[a->nd - 1] == 0) a->nd -= 1;
+    if (a->nd == 0) a->dp = 0;
+}
+
+static inline void
+sv_decimal_push_(SvDecimal_ *a, unsigned char digit)
+{
+    if (a->nd < SV_DECIMAL_DIGITS_) a->d[a->nd++] = digit;
+    else if (digit != 0)            a->truncated = true;
+}
+
+// Multiply by 2^k, k <= SV_DECIMAL_SHIFT_
+static inline void
+sv_decimal_shl_(SvDecimal_ *a, unsigned k)
+{
+    unsigned char tmp[SV_DECIMAL_DIGITS_ + 24];
+    size_t        w = sizeof tmp;
+    uint64_t      n = 0;
+
+    for (int32_t r = a->nd - 1; r >= 0; --r) {
+        n += (uint64_t)a->d[r] << k;
+        const uint64_t quo = n / 10;
+        tmp[--w] = (unsigned char)(n - 10 * quo);
+        n = quo;
+    }
+    while (n > 0) {
+        const uint64_t quo = n / 10;
+        tmp[--w] = (unsigned char)(n - 10 * quo);
+        n = quo;
+    }
+
+    int32_t nd = (int32_t)(sizeof tmp - w);
+    a->dp += nd - a->nd;
+    if (nd > SV_DECIMAL_DIGITS_) {
+        for (int32_t i = SV_DECIMAL_DIGITS_; i < nd; ++i) {
+            if (tmp[w + (size_t)i]) a->truncated = true;
+        }
+        nd = SV_DECIMAL_DIGITS_;
+    }
+    memcpy(a->d, tmp + w, (size_t)nd);
+    a->nd = nd;
+    sv_decimal_trim_(a);
+}
+
+// Divide by 2^k, k <= SV_DECIMAL_SHIFT_
+static inline void
+sv_decimal_shr_(SvDecimal_ *a, unsigned k)
+{
+    int32_t        r = 0;
+    int32_t        w = 0;
+    uint64_t       n = 0;
+    const uint64_t mask = ((uint64_t)1 << k) - 1;
+
+    // Read digits until the quotient has a leading digit
+    for (; (n >> k) == 0; ++r) {
+        if (r >= a->nd) {
+            if (n == 0) { a->nd = 0; a->dp = 0; return; }
+            while ((n >> k) == 0) { n *= 10; ++r; }
+            break;
+        }
+        n = n * 10 + a->d[r];
+    }
+    a->dp -= r - 1;
+
+    for (; r < a->nd; ++r) {
+        const uint64_t digit = n >> k;
+        n &= mask;
+        a->d[w++] = (unsigned char)digit;
+        n = n * 10 + a->d[r];
+    }
+    while (n > 0) {
+        const uint64_t digit = n >> k;
+        n &= mask;
+        if (w < SV_DECIMAL_DIGITS_) a->d[w++] = (unsigned char)digit;
+        else if (digit > 0)         a->truncated = true;
+        n *= 10;
+    }
+    a->nd = w;
+    sv_decimal_trim_(a);
+}
+
+static inline void
+sv_decimal_shift_(SvDecimal_ *a, int k)
+{
+    if (a->nd == 0) return;
+    while (k > SV_DECIMAL_SHIFT_)  { sv_decimal_shl_(a, SV_DECIMAL_SHIFT_); k -= SV_DECIMAL_SHIFT_; }
+    while (k < -SV_DECIMAL_SHIFT_) { sv_decimal_shr_(a, SV_DECIMAL_SHIFT_); k += SV_DECIMAL_SHIFT_; }
+    if (k > 0) sv_decimal_shl_(a, (unsigned)k);
+    if (k < 0) sv_decimal_shr_(a, (unsigned)-k);
+}
+
+// Round the integer part to nearest, ties to even
+static inline uint64_t
+sv_decimal_round_(const SvDecimal_ *a)
+{
+    if (a->dp > 20) return UINT64_MAX;
+
+    uint64_t n = 0;
+    int32_t  i = 0;
+    for (; i < a->dp && i < a->nd; ++i) n = n * 10 + a->d[i];
+    for (; i < a->dp; ++i)              n *= 10;
+
+    const int32_t at = a->dp;
+    bool          up = false;
+    if (at >= 0 && at < a->nd) {
+        if (a->d[at] == 5 && at + 1 == a->nd) {
+            up = a->truncated || (at > 0 && (a->d[at - 1] & 1));
+        } else {
+            up = a->d[at] >= 5;
+        }
+    }
+    return n + (up ? 1 : 0);
+}
+
+// Exponent and mantissa fields (no sign) of the double nearest to a. Consumes a.
+static inline uint64_t
+sv_decimal_to_bits_(SvDecimal_ *a)
+{
+    static const int powtab[9] = { 1, 3, 6, 9, 13, 16, 19, 23, 26 };
+    const uint64_t   inf       = (uint64_t)0x7FF << 52;
+
+    if (a->nd == 0 || a->dp < -330) return 0;
+    if (a->dp > 310)                return inf;
+
+    // Scale by powers of two into [0.5, 1)
+    int exp2 = 0;
+    while (a->dp > 0) {
+        const int n = a->dp >= 9 ? 27 : powtab[a->dp];
+        sv_decimal_shift_(a, -n);
+        exp2 += n;
+    }
+    while (a->dp < 0 || (a->dp == 0 && a->d[0] < 5)) {
+        const int n = -a->dp >= 9 ? 27 : powtab[-a->dp];
+        sv_decimal_shift_(a, n);
+        exp2 -= n;
+    }
+
+    // [0.5, 1) -> [1, 2), then denormalize below the smallest exponent
+    exp2 -= 1;
+    if (exp2 < -1022) {
+        const int n = -1022 - exp2;
+        sv_decimal_shift_(a, -n);
+        exp2 += n;
+    }
+    if (exp2 + 1023 >= 0x7FF) return inf;
+
+    sv_decimal_shift_(a, 53);
+    uint64_t mantissa = sv_decimal_round_(a);
+    if (mantissa == (uint64_t)2 << 52) {
+        mantissa >>= 1;
+        exp2     += 1;
+        if (exp2 + 1023 >= 0x7FF) return inf;
+    }
+    if (!(mantissa & ((uint64_t)1 << 52))) exp2 = -1023;  // Subnormal
+
+    return ((uint64_t)(exp2 + 1023) << 52) | (mantissa & (((uint64_t)1 << 52) - 1));
+}
+
+// Append the significant digits of p[0..n) to w while it holds fewer than 19,
+// counting every significant digit in *nd. Leading zeros are not significant.
+static inline void
+sv_accumulate_digits_(const char *p, size_t n, uint64_t *w, size_t *nd)
+{
+    size_t i = 0;
+    if (*nd == 0) while (i < n && p[i] == '0') i += 1;
+
+    while (i < n && *nd < 19) {
+        uint64_t chunk;
+        if (*nd + 8 <= 19 && n - i >= 8 && sv_parse8_digits_(p + i, &chunk)) {
+            *w  = *w * 100000000ULL + chunk;
+            *nd += 8;
+            i   += 8;
+        } else {
+            *w  = *w * 10 + (uint64_t)(p[i] - '0');
+            *nd += 1;
+            i   += 1;
+        }
+    }
+    *nd += n - i;
+}
+
+static inline void
+sv_decimal_append_(SvDecimal_ *a, const char *p, size_t n, bool fraction)
+{
+    for (size_t i = 0; i < n; ++i) {
+        const unsigned char digit = (unsigned char)(p[i] - '0');
+        if (a->nd == 0 && digit == 0) {
+            if (fraction) a->dp -= 1;
+            continue;
+        }
+        sv_decimal_push_(a, digit);
+        if (!fraction) a->dp += 1;
+    }
+}
+
+// Parse the longest valid number at the start of begin[0..length) into *out.
+// Returns the number of bytes used, or 0 if there is no number or it overflows.
+static inline size_t
+sv_parse_double_(const char *begin, size_t length, double *out)
+{
+    if (length == 0) return 0;
+
+    const char *p   = begin;
+    const char *end = begin + length;
+
+    // Sign
+    bool neg = false;
+    if (*p == '+' || *p == '-') {
+        neg = (*p == '-');
+        p += 1;
+    }
+
+    // Integer part
+    const char  *int_begin  = p;
+    const size_t int_length = sv_digit_run_(p, (size_t)(end - p));
+    p += int_length;
+
+    // Fractional part, only if '.' is followed by at least one digit
+    const char *frac_begin  = p;
+    size_t      frac_length = 0;
+    if (end - p >= 2 && *p == '.' && p[1] >= '0' && p[1] <= '9') {
+        frac_begin  = p + 1;
+        frac_length = sv_digit_run_(frac_begin, (size_t)(end - frac_begin));
+        p           = frac_begin + frac_length;
+    }
+
+    if (int_length == 0 && frac_length == 0) return 0;
+
+    // Exponent, only if it has at least one digit
+    int64_t exp10 = 0;
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        const char *e       = p + 1;
+        bool        exp_neg = false;
+        if (e < end && (*e == '+' || *e == '-')) {
+            exp_neg = (*e == '-');
+            e += 1;
+        }
+        if (e < end && *e >= '0' && *e <= '9') {
+            while (e < end && *e >= '0' && *e <= '9') {
+                if (exp10 < 100000000) exp10 = exp10 * 10 + (*e - '0'); // cap growth
+                e += 1;
+            }
+            if (exp_neg) exp10 = -exp10;
+            p = e;
+        }
+    }
+
+    // value = w * 10^q, with w the first 19 significant digits
+    uint64_t w  = 0;
+    size_t   nd = 0;
+    sv_accumulate_digits_(int_begin, int_length, &w, &nd);
+    sv_accumulate_digits_(frac_begin, frac_length, &w, &nd);
+
+    uint64_t bits = 0;
+    if (nd > 0) {
+        const size_t kept = nd < 19 ? nd : 19;
+        const int64_t q   = exp10 - (int64_t)frac_length + (int64_t)(nd - kept);
+
+        bool exact = sv_eisel_lemire_(q, w, &bits);
+        if (exact && nd > 19) {
+            // Dropped digits put the true value in [w, w+1) * 10^q; if both
+            // ends round the same way, so does everything in between.
+            uint64_t bits_up;
+            exact = sv_eisel_lemire_(q, w + 1, &bits_up) && bits_up == bits;
+        }
+
+        if (!exact) {
+            SvDecimal_ dec;
+            dec.nd        = 0;
+            dec.dp        = 0;
+            dec.truncated = false;
+            sv_decimal_append_(&dec, int_begin, int_length, false);
+            sv_decimal_append_(&dec, frac_begin, frac_length, true);
+            const int64_t dp = (int64_t)dec.dp + exp10;
+            if      (dp >  310) bits = (uint64_t)0x7FF << 52;
+            else if (dp < -330) bits = 0;
+            else {
+                dec.dp = (int32_t)dp;
+                sv_decimal_trim_(&dec);
+                bits = sv_decimal_to_bits_(&dec);
+            }
+        }
+
+        if ((bits >> 52) == 0x7FF) return 0; // overflow to infinity
+    }
+
+    if (neg) bits |= (uint64_t)1 << 63;
+    memcpy(out, &bits, sizeof *out);
+    return (size_t)(p - begin);
+}
+
+SVDEF bool
+sv_to_double(StringView sv, double *out) SV_NOEXCEPT
+{
+    if (!out || sv.length == 0) return false;
+
+    // Must consume everything
+    double value;
+    if (sv_parse_double_(sv.begin, sv.length, &value) != sv.length) return false;
+
+    *out = value;
+    return true;
+}
+
+SVDEF bool
+sv_parse_uint64_prefix(StringView sv, uint64_t *out, size_t *out_consumed) SV_NOEXCEPT
+{
+    if (out_consumed) *out_consumed = 0;
+    if (!out || sv.length == 0) return false;
+
+    const size_t sign = sv.begin[0] == '+' ? 1 : 0;
+    const size_t run  = sv_digit_run_(sv.begin + sign, sv.length - sign);
+    if (run == 0) return false;
+
+    uint64_t value;
+    if (!sv_parse_digits_u64_(sv.begin + sign, run, &value)) return false;
+
+    *out = value;
+    if (out_consumed) *out_consumed = sign + run;
+    return true;
+}
+
+SVDEF bool
+sv_parse_int64_prefix(StringView sv, int64_t *out, size_t *out_consumed) SV_NOEXCEPT
+{
+    if (out_consumed) *out_consumed = 0;
+    if (!out || sv.length == 0) return false;
+
+    const bool   neg  = sv.begin[0] == '-';
+    const size_t sign = (neg || sv.begin[0] == '+') ? 1 : 0;
+    const size_t run  = sv_digit_run_(sv.begin + sign, sv.length - sign);
+    if (run == 0) return false;
+
+    uint64_t       acc;
+    const uint64_t limit = neg ? (uint64_t)INT64_MAX + 1ULL : (uint64_t)INT64_MAX;
+    if (!sv_parse_digits_u64_(sv.begin + sign, run, &acc) || acc > limit) return false;
+
+    if (neg) *out = acc == limit ? INT64_MIN : -(int64_t)acc;
+    else     *out = (int64_t)acc;
+    if (out_consumed) *out_consumed = sign + run;
+    return true;
+}
+
+SVDEF bool
+sv_parse_double_prefix(StringView sv, double *out, size_t *out_consumed) SV_NOEXCEPT
+{
+    if (out_consumed) *out_consumed = 0;
+    if (!out) return false;
+
+    double       value;
+    const size_t used = sv_parse_double_(sv.begin, sv.length, &value);
+    if (used == 0) return false;
+
+    *out = value;
+    if (out_consumed) *out_consumed = used;
+    return true;
+}
+
+// sv_to_int64 without the call and NULL checks, for the batch loops. Values of
+// up to 16 digits are right-aligned into a '0'-padded buffer so validation and
+// conversion are one or two SWAR steps with no per-digit branches.
+static inline bool
+sv_parse_int64_fast_(const char *p, size_t n, int64_t *out)
+{
+    if (n == 0) return false;
+
+    const bool   neg  = *p == '-';
+    const size_t sign = (neg || *p == '+') ? 1 : 0;
+    p += sign;
+    n -= sign;
+    if (n == 0) return false;
+
+    uint64_t acc;
+    if (n <= 8) {
+        char buf[8];
+        memset(buf, '0', sizeof buf);
+        memcpy(buf + 8 - n, p, n);
+        if (!sv_parse8_digits_(buf, &acc)) return false;
+    } else if (n <= 16) {
+        char     buf[16];
+        uint64_t hi;
+        memset(buf, '0', sizeof buf);
+        memcpy(buf + 16 - n, p, n);
+        if (!sv_parse8_digits_(buf, &hi) || !sv_parse8_digits_(buf + 8, &acc)) return false;
+        acc += hi * 100000000ULL;
+    } else {
+        const uint64_t limit = neg ? (uint64_t)INT64_MAX + 1ULL : (uint64_t)INT64_MAX;
+        if (!sv_parse_digits_u64_(p, n, &acc) || acc > limit) return false;
+        if (neg && acc == limit) { *out = INT64_MIN; return true; }
+    }
+
+    *out = neg ? -(int64_t)acc : (int64_t)acc;
+    return true;
+}
+
+SVDEF size_t
+sv_parse_int64_batch(const StringView *values,
+                     size_t            count,
+                     int64_t          *out,
+                     uint8_t          *validity) SV_NOEXCEPT
+{
+    SV_ASSERT((values != NULL && out != NULL) || count == 0);
+
+    size_t first_error = SV_NPOS;
+    for (size_t base = 0; base < count; base += 8) {
+        const size_t m    = count - base < 8 ? count - base : 8;
+        unsigned     bits = 0;
+        for (size_t j = 0; j < m; ++j) {
+            int64_t v;
+            if (sv_parse_int64_fast_(values[base + j].begin, values[base + j].length, &v)) {
+                bits |= 1u << j;
+            } else {
+                v = 0;
+                if (first_error == SV_NPOS) first_error = base + j;
+            }
+            out[base + j] = v;
+        }
+        if (validity) validity[base / 8] = (uint8_t)bits;
+    }
+    return first_error;
+}
+
+SVDEF size_t
+sv_parse_double_batch(const StringView *values,
+                      size_t            count,
+                      double           *out,
+                      uint8_t          *validity) SV_NOEXCEPT
+{
+    SV_ASSERT((values != NULL && out != NULL) || count == 0);
+
+    size_t first_error = SV_NPOS;
+    for (size_t base = 0; base < count; base += 8) {
+        const size_t m    = count - base < 8 ? count - base : 8;
+        unsigned     bits = 0;
+        for (size_t j = 0; j < m; ++j) {
+            const StringView sv = values[base + j];
+            double           v;
+            if (sv.length != 0 && sv_parse_double_(sv.begin, sv.length, &v) == sv.length) {
+                bits |= 1u << j;
+            } else {
+                v = 0.0;
+                if (first_error == SV_NPOS) first_error = base + j;
+            }
+            out[base + j] = v;
+        }
+        if (validity) validity[base / 8] = (uint8_t)bits;
+    }
+    return first_error;
+}
+
+// Fields are split 64 at a time, so every chunk starts on a validity byte.
+#define SV_PARSE_FIELDS_CHUNK_ 64
+
+static inline size_t
+sv_parse_int64_chunk_(const StringView *values, size_t count, void *out, uint8_t *validity)
+{
+    return sv_parse_int64_batch(values, count, (int64_t *)out, validity);
+}
+
+static inline size_t
+sv_parse_double_chunk_(const StringView *values, size_t count, void *out, uint8_t *validity)
+{
+    return sv_parse_double_batch(values, count, (double *)out, validity);
+}
+
+// Split sv into chunks of fields and hand each to parse, which writes values of
+// value_size bytes. Shared by the typed *_fields() functions.
+static inline size_t
+sv_parse_fields_(StringView sv,
+                 char       delim,
+                 size_t (*parse)(const StringView *, size_t, void *, uint8_t *),
+                 void      *out,
+                 size_t     value_size,
+                 uint8_t   *validity,
+                 size_t     cap,
+                 size_t    *out_next,
+                 size_t    *out_first_error)
+{
+    StringView fields[SV_PARSE_FIELDS_CHUNK_];
+    size_t     count       = 0;
+    size_t     offset      = 0;
+    size_t     first_error = SV_NPOS;
+    bool       finished    = false;
+
+    while (count < cap && !finished) {
+        const size_t want = cap - count < SV_PARSE_FIELDS_CHUNK_ ? cap - count : SV_PARSE_FIELDS_CHUNK_;
+        size_t       next;
+        const size_t n   = sv_split_into(sv_drop(sv, offset), delim, fields, want, &next);
+        const size_t err = parse(fields, n, (char *)out + count * value_size, validity ? validity + count / 8 : NULL);
+        if (err != SV_NPOS && first_error == SV_NPOS) first_error = count + err;
+
+        count += n;
+        if (next == SV_NPOS) finished = true;
+        else                 offset += next;
+    }
+
+    if (out_next)        *out_next        = finished ? SV_NPOS : offset;
+    if (out_first_error) *out_first_error = first_error;
+    return count;
+}
+
+SVDEF size_t
+sv_parse_int64_fields(StringView  sv,
+                      char        delim,
+                      int64_t    *out,
+                      uint8_t    *validity,
+                      size_t      cap,
+                      size_t     *out_next,
+                      size_t     *out_first_error) SV_NOEXCEPT
+{
+    return sv_parse_fields_(sv, delim, sv_parse_int64_chunk_, out, sizeof *out, validity, cap, out_next, out_first_error);
+}
+
+SVDEF size_t
+sv_parse_double_fields(StringView  sv,
+                       char        delim,
+                       double     *out,
+                       uint8_t    *validity,
+                       size_t      cap,
+                       size_t     *out_next,
+                       size_t     *out_first_error) SV_NOEXCEPT
+{
+    return sv_parse_fields_(sv, delim, sv_parse_double_chunk_, out, sizeof *out, validity, cap, out_next, out_first_error);
+}
+
+#undef SV_PARSE_FIELDS_CHUNK_
+
+SVDEF bool
+sv_parse_uint64_and_consume(StringView *sv, uint64_t *out) SV_NOEXCEPT
+{
+    SV_ASSERT(sv != NULL);
+
+    size_t used;
+    if (!sv_parse_uint64_prefix(*sv, out, &used)) return false;
+    *sv = sv_drop(*sv, used);
+    return true;
+}
+
+SVDEF bool
+sv_parse_int64_and_consume(StringView *sv, int64_t *out) SV_NOEXCEPT
+{
+    SV_ASSERT(sv != NULL);
+
+    size_t used;
+    if (!sv_parse_int64_prefix(*sv, out, &used)) return false;
+    *sv = sv_drop(*sv, used);
+    return true;
+}
+
+SVDEF bool
+sv_parse_double_and_consume(StringView *sv, double *out) SV_NOEXCEPT
+{
+    SV_ASSERT(sv != NULL);
+
+    size_t used;
+    if (!sv_parse_double_prefix(*sv, out, &used)) return false;
+    *sv = sv_drop(*sv, used);
+    return true;
+}
+
+static const char sv_digit_pairs_[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+// Number of decimal digits in v (1 for 0). log10 is estimated from the bit
+// length (1233/4096 ~ log10(2)) and corrected by a single compare.
+static inline unsigned
+sv_decimal_length_(uint64_t v)
+{
+    static const uint64_t pow10[20] = {
+        1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+        100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL,
+        10000000000000ULL, 100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+        100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL,
+    };
+    const uint64_t x = v | 1;
+    const unsigned t = ((sv_msb64_(x) + 1) * 1233) >> 12;
+    return t + 1 - (x < pow10[t]);
+}
+
+// Write the digits of v so that they end just before end, two at a time.
+static inline void
+sv_write_digits_(char *end, uint64_t v)
+{
+    while (v >= 100) {
+        const unsigned pair = (unsigned)(v % 100) * 2;
+        v /= 100;
+        end -= 2;
+        end[0] = sv_digit_pairs_[pair];
+        end[1] = sv_digit_pairs_[pair + 1];
+    }
+    if (v >= 10) {
+        end[-2] = sv_digit_pairs_[v * 2];
+        end[-1] = sv_digit_pairs_[v * 2 + 1];
+    } else {
+        end[-1] = (char)('0' + v);
+    }
+}
+
+static inline StringView
+sv_fmt_magnitude_(bool negative, uint64_t magnitude, char *buffer, size_t buffer_size)
+{
+    const size_t length = (size_t)negative + sv_decimal_length_(magnitude);
+    if (!buffer || buffer_size < length) return sv_empty();
+
+    if (negative) buffer[0] = '-';
+    sv_write_digits_(buffer + length, magnitude);
+    return sv_from_parts(buffer, length);
+}
+
+SVDEF StringView
+sv_fmt_uint64(uint64_t value, char *buffer, size_t buffer_size) SV_NOEXCEPT
+{
+    return sv_fmt_magnitude_(false, value, buffer, buffer_size);
+}
+
+SVDEF StringView
+sv_fmt_int64(int64_t value, char *buffer, size_t buffer_size) SV_NOEXCEPT
+{
+    const uint64_t magnitude = value < 0 ? 0 - (uint64_t)value : (uint64_t)value;
+    return sv_fmt_magnitude_(value < 0, magnitude, buffer, buffer_size);
+}
+
+// Upper 64 bits of g * cp / 2^64 with the discarded bits folded into the lowest
+// bit (round to odd), g being the 128-bit g_hi:g_lo.
+static inline uint64_t
+sv_round_to_odd_(uint64_t g_hi, uint64_t g_lo, uint64_t cp)
+{
+    uint64_t x_hi, y_hi;
+    (void)sv_mul128_(g_lo, cp, &x_hi);
+    const uint64_t y_lo = sv_mul128_(g_hi, cp, &y_hi);
+    const uint64_t z    = y_lo + x_hi;
+    return (y_hi + (z < y_lo)) | (z > 1);
+}
+
+// Schubfach (Giulietti, "The Schubfach way to render doubles"): the shortest
+// decimal c * 10^k inside the rounding interval of the finite, positive double
+// with the given bits, nearest to it when several digit strings qualify.
+static inline uint64_t
+sv_shortest_decimal_(uint64_t bits, int *out_k)
+{
+    const uint64_t fraction = bits & (((uint64_t)1 << 52) - 1);
+    const int      biased   = (int)(bits >> 52);
+    uint64_t       c;
+    int            q;
+
+    if (biased != 0) {
+        c = fraction | ((uint64_t)1 << 52);
+        q = biased - 1075;
+        // Small integers are already their own shortest representation.
+        if (q <= 0 && q > -53 && (c & (((uint64_t)1 << -q) - 1)) == 0) {
+            *out_k = 0;
+            return c >> -q;
+        }
+    } else {
+        c = fraction;
+        q = -1074;
+    }
+
+    const unsigned odd          = (unsigned)(c & 1);
+    const bool     lower_closer = fraction == 0 && biased > 1;
+    const uint64_t cbl          = 4 * c - 2 + lower_closer;
+    const uint64_t cb           = 4 * c;
+    const uint64_t cbr          = 4 * c + 2;
+
+    // k = floor(log10(2^q)), or of 3/4 * 2^q when the lower neighbour is closer;
+    // h in [1, 4] aligns 2^q / 10^k with the table entry for 10^-k.
+    const int k = (int)sv_floor_shr_((int64_t)q * 1262611 - (lower_closer ? 524031 : 0), 22);
+    const int h = q + (int)sv_floor_shr_((int64_t)-k * 1741647, 19) + 1;
+
+    const uint64_t *g    = sv_pow5_128_[-k - SV_POW5_MIN_];
+    uint64_t        g_hi = g[0];
+    uint64_t        g_lo = g[1];
+    if (-k < -27 || -k > 55) { // truncated entry, round up
+        g_lo += 1;
+        g_hi += g_lo == 0;
+    }
+
+    const uint64_t vbl   = sv_round_to_odd_(g_hi, g_lo, cbl << h);
+    const uint64_t vb    = sv_round_to_odd_(g_hi, g_lo, cb << h);
+    const uint64_t vbr   = sv_round_to_odd_(g_hi, g_lo, cbr << h);
+    const uint64_t lower = vbl + odd;
+    const uint64_t upper = vbr - odd;
+    const uint64_t s     = vb >> 2;
+
+    if (s >= 10) {
+        const uint64_t sp        = s / 10;
+        const bool     up_inside = lower <= 40 * sp;
+        const bool     wp_inside = 40 * sp + 40 <= upper;
+        if (up_inside != wp_inside) {
+            *out_k = k + 1;
+            return sp + wp_inside;
+        }
+    }
+
+    *out_k = k;
+    const bool u_inside = lower <= 4 * s;
+    const bool w_inside = 4 * s + 4 <= upper;
+    if (u_inside != w_inside) return s + w_inside;
+
+    const uint64_t mid = 4 * s + 2;
+    return s + (vb > mid || (vb == mid && (s & 1) != 0));
+}
+
+SVDEF StringView
+sv_fmt_double(double value, char *buffer, size_t buffer_size) SV_NOEXCEPT
+{
+    char     tmp[SV_FMT_DOUBLE_LEN];
+    size_t   n = 0;
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof bits);
+
+    if (bits >> 63) tmp[n++] = '-';
+    bits &= ~((uint64_t)1 << 63);
+
+    if (bits >= (uint64_t)0x7FF << 52) {
+        if (bits > (uint64_t)0x7FF << 52) n = 0; // no sign on nan
+        memcpy(tmp + n, bits > (uint64_t)0x7FF << 52 ? "nan" : "inf", 3);
+        n += 3;
+    } else if (bits == 0) {
+        tmp[n++] = '0';
+    } else {
+        int      k;
+        uint64_t digits = sv_shortest_decimal_(bits, &k);
+        while (digits % 10 == 0) { digits /= 10; k += 1; }
+
+        // value = 0.DIGITS * 10^point
+        const int len   = (int)sv_decimal_length_(digits);
+        const int point = len + k;
+
+        if (point > 0 && point <= 21) {
+            if (point >= len) {
+                sv_write_digits_(tmp + n + len, digits);
+                memset(tmp + n + len, '0', (size_t)(point - len));
+                n += (size_t)point;
+            } else {
+                // Write as if there was no point, then shift the fraction over.
+                sv_write_digits_(tmp + n + len, digits);
+                memmove(tmp + n + point + 1, tmp + n + point, (size_t)(len - point));
+                tmp[n + (size_t)point] = '.';
+                n += (size_t)len + 1;
+            }
+        } else if (point <= 0 && point > -6) {
+            tmp[n++] = '0';
+            tmp[n++] = '.';
+            memset(tmp + n, '0', (size_t)-point);
+            n += (size_t)-point;
+            sv_write_digits_(tmp + n + len, digits);
+            n += (size_t)len;
+        } else {
+            sv_write_digits_(tmp + n + len, digits);
+            if (len > 1) {
+                memmove(tmp + n + 2, tmp + n + 1, (size_t)(len - 1));
+                tmp[n + 1] = '.';
+                n += 1;
+            }
+            n += (size_t)len;
+
+            const int exp10 = point - 1;
+            tmp[n++] = 'e';
+            tmp[n++] = exp10 < 0 ? '-' : '+';
+            const unsigned exp_len = sv_decimal_length_((uint64_t)(exp10 < 0 ? -exp10 : exp10));
+            sv_write_digits_(tmp + n + exp_len, (uint64_t)(exp10 < 0 ? -exp10 : exp10));
+            n += exp_len;
+        }
+    }
+
+    if (!buffer || buffer_size < n) return sv_empty();
+    memcpy(buffer, tmp, n);
+    return sv_from_parts(buffer, n);
+}
+
+SVDEF uint64_t
+sv_hash(StringView sv) SV_NOEXCEPT
+{
+#ifdef SV_HASH_WYHASH
+    return sv_hash64_seeded(sv, 0);
+#else
+    return sv_hash_fnv1a(sv);
+#endif
+}
+
+#define SV_FNV_BASIS_ 1469598103934665603ULL // offset basis (see declaration)
+#define SV_FNV_PRIME_ 1099511628211ULL       // 2^40 + 0x1b3
+
+// FNV-1a: http://www.isthe.com/chongo/tech/comp/fnv/
+static inline uint64_t
+sv_fnv1a_update_(uint64_t hash, const char *p, size_t n)
+{
+    for (size_t i = 0; i < n; ++i) {
+        hash ^= (unsigned char)p[i];
+        hash *= SV_FNV_PRIME_;
+    }
+    return hash;
+}
+
+SVDEF uint64_t
+sv_hash_fnv1a(StringView sv) SV_NOEXCEPT
+{
+    return sv_fnv1a_update_(SV_FNV_BASIS_, sv.begin, sv.length);
+}
+
+// FNV-1a is one multiply per byte, each waiting on the last. Four keys in
+// lockstep give four independent chains; longer keys finish one at a time.
+static inline void
+sv_fnv1a_batch4_(const StringView *k, uint64_t *out)
+{
+    size_t shortest = k[0].length;
+    for (int j = 1; j < 4; ++j) {
+        if (k[j].length < shortest) shortest = k[j].length;
+    }
+
+    const unsigned char *p0 = (const unsigned char *)k[0].begin, *p1 = (const unsigned char *)k[1].begin;
+    const unsigned char *p2 = (const unsigned char *)k[2].begin, *p3 = (const unsigned char *)k[3].begin;
+    uint64_t h0 = SV_FNV_BASIS_, h1 = SV_FNV_BASIS_, h2 = SV_FNV_BASIS_, h3 = SV_FNV_BASIS_;
+    for (size_t i = 0; i < shortest; ++i) {
+        h0 = (h0 ^ p0[i]) * SV_FNV_PRIME_;
+        h1 = (h1 ^ p1[i]) * SV_FNV_PRIME_;
+        h2 = (h2 ^ p2[i]) * SV_FNV_PRIME_;
+        h3 = (h3 ^ p3[i]) * SV_FNV_PRIME_;
+    }
+
+    out[0] = sv_fnv1a_update_(h0, k[0].begin + shortest, k[0].length - shortest);
+    out[1] = sv_fnv1a_update_(h1, k[1].begin + shortest, k[1].length - shortest);
+    out[2] = sv_fnv1a_update_(h2, k[2].begin + shortest, k[2].length - shortest);
+    out[3] = sv_fnv1a_update_(h3, k[3].begin + shortest, k[3].length - shortest);
+}
+
+SVDEF void
+sv_hash_batch(const StringView *keys, size_t n, uint64_t *out) SV_NOEXCEPT
+{
+    SV_ASSERT(keys != NULL || n == 0);
+    SV_ASSERT(out != NULL || n == 0);
+
+    size_t i = 0;
+#ifdef SV_HASH_WYHASH
+    for (; i < n; ++i) out[i] = sv_hash64_seeded(keys[i], 0);
+#else
+    for (; i + 4 <= n; i += 4) sv_fnv1a_batch4_(keys + i, out + i);
+    for (; i < n; ++i) out[i] = sv_hash_fnv1a(keys[i]);
+#endif
+}
+
+static inline uint64_t
+sv_load_le32_(const char *p)
+{
+    uint32_t w;
+    memcpy(&w, p, 4);
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    w = __builtin_bswap32(w);
+#endif
+    return w;
+}
+
+// Fold the 128-bit product of a and b into 64 bits.
+static inline uint64_t
+sv_wymix_(uint64_t a, uint64_t b)
+{
+    uint64_t hi;
+    const uint64_t lo = sv_mul128_(a, b, &hi);
+    return lo ^ hi;
+}
+
+// Odd constants with 4 bits set per byte and pairwise Hamming distance 32.
+// The first row is wyhash's default secret, the second drives the high lane of
+// sv_hash128_seeded().
+static const uint64_t sv_wyhash_secret_[2][4] = {
+    { 0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL },
+    { 0x3ca94d2bcc55c555ULL, 0xc94d7493b85a5665ULL, 0x4ea6569c8b4bb153ULL, 0x8e1d596669d2b48bULL },
+};
+
+// Hash of a key of at most 16 bytes, read whole into a and b
+static inline uint64_t
+sv_wyhash_short_(const char *p, size_t length, uint64_t seed, const uint64_t *secret)
+{
+    uint64_t a = 0, b = 0;
+    if (length >= 4) {
+        // Two (possibly overlapping) 4-byte loads from each end
+        const size_t mid = (length >> 3) << 2;
+        a = (sv_load_le32_(p) << 32) | sv_load_le32_(p + mid);
+        b = (sv_load_le32_(p + length - 4) << 32) | sv_load_le32_(p + length - 4 - mid);
+    } else if (length > 0) {
+        a = ((uint64_t)(unsigned char)p[0] << 16) | ((uint64_t)(unsigned char)p[length >> 1] << 8) |
+            (uint64_t)(unsigned char)p[length - 1];
+    }
+    a = sv_mul128_(a ^ secret[1], b ^ seed, &b);
+    return sv_wymix_(a ^ secret[0] ^ length, b ^ secret[1]);
+}
+
+// Three independent lanes so the multiplies can overlap
+static inline void
+sv_wyhash_block_(const char *p, uint64_t lanes[3], const uint64_t *secret)
+{
+    lanes[0] = sv_wymix_(sv_load_le64_(p) ^ secret[1], sv_load_le64_(p + 8) ^ lanes[0]);
+    lanes[1] = sv_wymix_(sv_load_le64_(p + 16) ^ secret[2], sv_load_le64_(p + 24) ^ lanes[1]);
+    lanes[2] = sv_wymix_(sv_load_le64_(p + 32) ^ secret[3], sv_load_le64_(p + 40) ^ lanes[2]);
+}
+
+// Mix the last i (< 48) bytes at p of a key longer than 16 bytes. The final
+// 16-byte read may reach back before p, into bytes that were already mixed.
+static inline uint64_t
+sv_wyhash_tail_(const char *p, size_t i, uint64_t seed, uint64_t length, const uint64_t *secret)
+{
+    while (i > 16) {
+        seed = sv_wymix_(sv_load_le64_(p) ^ secret[1], sv_load_le64_(p + 8) ^ seed);
+        p += 16;
+        i -= 16;
+    }
+    uint64_t       b = sv_load_le64_(p + i - 8);
+    const uint64_t a = sv_mul128_(sv_load_le64_(p + i - 16) ^ secret[1], b ^ seed, &b);
+    return sv_wymix_(a ^ secret[0] ^ length, b ^ secret[1]);
+}
+
+// wyhash final4: https://github.com/wangyi-fudan/wyhash
+static inline uint64_t
+sv_wyhash_(const char *p, size_t length, uint64_t seed, const uint64_t *secret)
+{
+    seed ^= sv_wymix_(seed ^ secret[0], secret[1]);
+
+    if (length <= 16) return sv_wyhash_short_(p, length, seed, secret);
+
+    size_t i = length;
+    if (i >= 48) {
+        uint64_t lanes[3] = { seed, seed, seed };
+        do {
+            sv_wyhash_block_(p, lanes, secret);
+            p += 48;
+            i -= 48;
+        } while (i >= 48);
+        seed = lanes[0] ^ lanes[1] ^ lanes[2];
+    }
+    return sv_wyhash_tail_(p, i, seed, length, secret);
+}
+
+SVDEF uint64_t
+sv_hash64_seeded(StringView sv, uint64_t seed) SV_NOEXCEPT
+{
+    return sv_wyhash_(sv.begin, sv.length, seed, sv_wyhash_secret_[0]);
+}
+
+SVDEF SvHash128
+sv_hash128_seeded(StringView sv, uint64_t seed) SV_NOEXCEPT
+{
+    SvHash128 h;
+    h.lo = sv_wyhash_(sv.begin, sv.length, seed, sv_wyhash_secret_[0]);
+    h.hi = sv_wyhash_(sv.begin, sv.length, seed, sv_wyhash_secret_[1]);
+    return h;
+}
+
+SVDEF void
+sv_hasher_init(SvHasher *hasher, SvHasherKind kind, uint64_t seed) SV_NOEXCEPT
+{
+    SV_ASSERT(hasher != NULL);
+
+    memset(hasher, 0, sizeof *hasher);
+    hasher->kind = kind;
+    if (kind == SV_HASHER_FNV1A) {
+        hasher->state[0] = SV_FNV_BASIS_;
+    } else {
+        const uint64_t *secret = sv_wyhash_secret_[0];
+        seed ^= sv_wymix_(seed ^ secret[0], secret[1]);
+        hasher->state[0] = hasher->state[1] = hasher->state[2] = seed;
+    }
+}
+
+// wyhash mixes 48-byte blocks as soon as they are complete, since the one-shot
+// hash does so for every block that starts at least 48 bytes before the end.
+// Only the tail after the last block is buffered, behind the block's last 16
+// bytes, which the final read may overlap.
+SVDEF void
+sv_hasher_update(SvHasher *hasher, StringView sv) SV_NOEXCEPT
+{
+    SV_ASSERT(hasher != NULL);
+    if (sv.length == 0) return;
+
+    const char *p = sv.begin;
+    size_t      n = sv.length;
+    hasher->length += n;
+
+    if (hasher->kind == SV_HASHER_FNV1A) {
+        hasher->state[0] = sv_fnv1a_update_(hasher->state[0], p, n);
+        return;
+    }
+
+    const uint64_t *secret = sv_wyhash_secret_[0];
+    char           *buffer = (char *)hasher->buffer;
+    if (hasher->pending + n < 48) {
+        memcpy(buffer + 16 + hasher->pending, p, n);
+        hasher->pending += n;
+        return;
+    }
+
+    if (hasher->pending) {
+        const size_t take = 48 - hasher->pending;
+        memcpy(buffer + 16 + hasher->pending, p, take);
+        sv_wyhash_block_(buffer + 16, hasher->state, secret);
+        memcpy(buffer, buffer + 48, 16);
+        hasher->pending = 0;
+        p += take;
+        n -= take;
+    }
+    if (n >= 48) {
+        do {
+            sv_wyhash_block_(p, hasher->state, secret);
+            p += 48;
+            n -= 48;
+        } while (n >= 48);
+        memcpy(buffer, p - 16, 16);
+    }
+    memcpy(buffer + 16, p, n);
+    hasher->pending = n;
+}
+
+SVDEF uint64_t
+sv_hasher_final(const SvHasher *hasher) SV_NOEXCEPT
+{
+    SV_ASSERT(hasher != NULL);
+    if (hasher->kind == SV_HASHER_FNV1A) return hasher->state[0];
+
+    const uint64_t *secret = sv_wyhash_secret_[0];
+    const char     *tail   = (const char *)hasher->buffer + 16;
+    uint64_t        seed   = hasher->state[0];
+
+    if (hasher->length <= 16) return sv_wyhash_short_(tail, hasher->pending, seed, secret);
+    if (hasher->length >= 48) seed ^= hasher->state[1] ^ hasher->state[2];
+    return sv_wyhash_tail_(tail, hasher->pending, seed, hasher->length, secret);
+}
+
+#undef SV_FNV_BASIS_
+#undef SV_FNV_PRIME_
+
+#if SV_HAS_SSE42
+#define SV_CRC32C_LONG_  8192 // bytes per stream, then x^(8 * 8192) mod P
+#define SV_CRC32C_SHORT_ 256  // with PCLMUL only, then x^(8 * 256) mod P
+
+static inline uint32_t
+sv_crc32c_word_(uint32_t crc, const char *p)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    return (uint32_t)_mm_crc32_u64(crc, sv_load_le64_(p));
+#else
+    crc = _mm_crc32_u32(crc, (uint32_t)sv_load_le32_(p));
+    return _mm_crc32_u32(crc, (uint32_t)sv_load_le32_(p + 4));
+#endif
+}
+
+// a * b modulo the CRC32C polynomial, in its bit-reflected form (x^0 is the top bit)
+static inline uint32_t
+sv_crc32c_mul_(uint32_t a, uint32_t b)
+{
+#if SV_HAS_PCLMUL
+    // The 63-bit product, shifted up one to reflect it as 64 bits; crc32 of the
+    // low half with a zero CRC reduces it, the high half is already reduced.
+    const __m128i product = _mm_slli_epi64(_mm_clmulepi64_si128(_mm_cvtsi32_si128((int)a), _mm_cvtsi32_si128((int)b), 0), 1);
+    return _mm_crc32_u32(0, (uint32_t)_mm_cvtsi128_si32(product)) ^ (uint32_t)_mm_extract_epi32(product, 1);
+#else
+    uint32_t result = 0;
+    for (uint32_t m = 1u << 31; m != 0; m >>= 1) {
+        if (a & m) result ^= b;
+        b = (b >> 1) ^ (0x82f63b78u & (0u - (b & 1u)));
+    }
+    return result;
+#endif
+}
+
+// crc32 has a latency of three cycles but issues every cycle, so runs of
+// 3 * block bytes go through three independent chains. The first two are then
+// moved past the bytes after them by multiplying with shift, x^(8 * block).
+static inline uint32_t
+sv_crc32c_3way_(uint32_t crc, const char **p, size_t *n, size_t block, uint32_t shift)
+{
+    for (; *n >= 3 * block; *p += 3 * block, *n -= 3 * block) {
+        const char *a = *p, *b = a + block, *c = b + block;
+        uint32_t    crc_b = 0, crc_c = 0;
+        for (size_t i = 0; i < block; i += 8) {
+            crc   = sv_crc32c_word_(crc, a + i);
+            crc_b = sv_crc32c_word_(crc_b, b + i);
+            crc_c = sv_crc32c_word_(crc_c, c + i);
+        }
+        crc = sv_crc32c_mul_(shift, crc) ^ crc_b;
+        crc = sv_crc32c_mul_(shift, crc) ^ crc_c;
+    }
+    return crc;
+}
+#else
+// sv_crc32c_table_[k][b]: CRC32C of byte b followed by k zero bytes
+static const uint32_t sv_crc32c_table_[8][256] = {
+    {
+        0x00000000, 0xf26b8303, 0xe13b70f7, 0x1350f3f4, 0xc79a971f, 0x35f1141c, 0x26a1e7e8, 0xd4ca64eb,
+        0x8ad958cf, 0x78b2dbcc, 0x6be22838, 0x9989ab3b, 0x4d43cfd0, 0xbf284cd3, 0xac78bf27, 0x5e133c24,
+        0x105ec76f, 0xe235446c, 0xf165b798, 0x030e349b, 0xd7c45070, 0x25afd373, 0x36ff2087, 0xc494a384,
+        0x9a879fa0, 0x68ec1ca3, 0x7bbcef57, 0x89d76c54, 0x5d1d08bf, 0xaf768bbc, 0xbc267848, 0x4e4dfb4b,
+        0x20bd8ede, 0xd2d60ddd, 0xc186fe29, 0x33ed7d2a, 0xe72719c1, 0x154c9ac2, 0x061c6936, 0xf477ea35,
+        0xaa64d611, 0x580f5512, 0x4b5fa6e6, 0xb93425e5, 0x6dfe410e, 0x9f95c20d, 0x8cc531f9, 0x7eaeb2fa,
+        0x30e349b1, 0xc288cab2, 0xd1d83946, 0x23b3ba45, 0xf779deae, 0x05125dad, 0x1642ae59, 0xe4292d5a,
+        0xba3a117e, 0x4851927d, 0x5b016189, 0xa96ae28a, 0x7da08661, 0x8fcb0562, 0x9c9bf696, 0x6ef07595,
+        0x417b1dbc, 0xb3109ebf, 0xa0406d4b, 0x522bee48, 0x86e18aa3, 0x748a09a0, 0x67dafa54, 0x95b17957,
+        0xcba24573, 0x39c9c670, 0x2a993584, 0xd8f2b687, 0x0c38d26c, 0xfe53516f, 0xed03a29b, 0x1f682198,
+        0x5125dad3, 0xa34e59d0, 0xb01eaa24, 0x42752927, 0x96bf4dcc, 0x64d4cecf, 0x77843d3b, 0x85efbe38,
+        0xdbfc821c, 0x2997011f, 0x3ac7f2eb, 0xc8ac71e8, 0x1c661503, 0xee0d9600, 0xfd5d65f4, 0x0f36e6f7,
+        0x61c69362, 0x93ad1061, 0x80fde395, 0x72966096, 0xa65c047d, 0x5437877e, 0x4767748a, 0xb50cf789,
+        0xeb1fcbad, 0x197448ae, 0x0a24bb5a, 0xf84f3859, 0x2c855cb2, 0xdeeedfb1, 0xcdbe2c45, 0x3fd5af46,
+        0x7198540d, 0x83f3d70e, 0x90a324fa, 0x62c8a7f9, 0xb602c312, 0x44694011, 0x5739b3e5, 0xa55230e6,
+        0xfb410cc2, 0x092a8fc1, 0x1a7a7c35, 0xe811ff36, 0x3cdb9bdd, 0xceb018de, 0xdde0eb2a, 0x2f8b6829,
+        0x82f63b78, 0x709db87b, 0x63cd4b8f, 0x91a6c88c, 0x456cac67, 0xb7072f64, 0xa457dc90, 0x563c5f93,
+        0x082f63b7, 0xfa44e0b4, 0xe9141340, 0x1b7f9043, 0xcfb5f4a8, 0x3dde77ab, 0x2e8e845f, 0xdce5075c,
+        0x92a8fc17, 0x60c37f14, 0x73938ce0, 0x81f80fe3, 0x55326b08, 0xa759e80b, 0xb4091bff, 0x466298fc,
+        0x1871a4d8, 0xea1a27db, 0xf94ad42f, 0x0b21572c, 0xdfeb33c7, 0x2d80b0c4, 0x3ed04330, 0xccbbc033,
+        0xa24bb5a6, 0x502036a5, 0x4370c551, 0xb11b4652, 0x65d122b9, 0x97baa1ba, 0x84ea524e, 0x7681d14d,
+        0x2892ed69, 0xdaf96e6a, 0xc9a99d9e, 0x3bc21e9d, 0xef087a76, 0x1d63f975, 0x0e330a81, 0xfc588982,
+        0xb21572c9, 0x407ef1ca, 0x532e023e, 0xa145813d, 0x758fe5d6, 0x87e466d5, 0x94b49521, 0x66df1622,
+        0x38cc2a06, 0xcaa7a905, 0xd9f75af1, 0x2b9cd9f2, 0xff56bd19, 0x0d3d3e1a, 0x1e6dcdee, 0xec064eed,
+        0xc38d26c4, 0x31e6a5c7, 0x22b65633, 0xd0ddd530, 0x0417b1db, 0xf67c32d8, 0xe52cc12c, 0x1747422f,
+        0x49547e0b, 0xbb3ffd08, 0xa86f0efc, 0x5a048dff, 0x8ecee914, 0x7ca56a17, 0x6ff599e3, 0x9d9e1ae0,
+        0xd3d3e1ab, 0x21b862a8, 0x32e8915c, 0xc083125f, 0x144976b4, 0xe622f5b7, 0xf5720643, 0x07198540,
+        0x590ab964, 0xab613a67, 0xb831c993, 0x4a5a4a90, 0x9e902e7b, 0x6cfbad78, 0x7fab5e8c, 0x8dc0dd8f,
+        0xe330a81a, 0x115b2b19, 0x020bd8ed, 0xf0605bee, 0x24aa3f05, 0xd6c1bc06, 0xc5914ff2, 0x37faccf1,
+        0x69e9f0d5, 0x9b8273d6, 0x88d28022, 0x7ab90321, 0xae7367ca, 0x5c18e4c9, 0x4f48173d, 0xbd23943e,
+        0xf36e6f75, 0x0105ec76, 0x12551f82, 0xe03e9c81, 0x34f4f86a, 0xc69f7b69, 0xd5cf889d, 0x27a40b9e,
+        0x79b737ba, 0x8bdcb4b9, 0x988c474d, 0x6ae7c44e, 0xbe2da0a5, 0x4c4623a6, 0x5f16d052, 0xad7d5351,
+    },
+    {
+        0x00000000, 0x13a29877, 0x274530ee, 0x34e7a899, 0x4e8a61dc, 0x5d28f9ab, 0x69cf5132, 0x7a6dc945,
+        0x9d14c3b8, 0x8eb65bcf, 0xba51f356, 0xa9f36b21, 0xd39ea264, 0xc03c3a13, 0xf4db928a, 0xe7790afd,
+        0x3fc5f181, 0x2c6769f6, 0x1880c16f, 0x0b225918, 0x714f905d, 0x62ed082a, 0x560aa0b3, 0x45a838c4,
+        0xa2d13239, 0xb173aa4e, 0x859402d7, 0x96369aa0, 0xec5b53e5, 0xfff9cb92, 0xcb1e630b, 0xd8bcfb7c,
+        0x7f8be302, 0x6c297b75, 0x58ced3ec, 0x4b6c4b9b, 0x310182de, 0x22a31aa9, 0x1644b230, 0x05e62a47,
+        0xe29f20ba, 0xf13db8cd, 0xc5da1054, 0xd6788823, 0xac154166, 0xbfb7d911, 0x8b507188, 0x98f2e9ff,
+        0x404e1283, 0x53ec8af4, 0x670b226d, 0x74a9ba1a, 0x0ec4735f, 0x1d66eb28, 0x298143b1, 0x3a23dbc6,
+        0xdd5ad13b, 0xcef8494c, 0xfa1fe1d5, 0xe9bd79a2, 0x93d0b0e7, 0x80722890, 0xb4958009, 0xa737187e,
+        0xff17c604, 0xecb55e73, 0xd852f6ea, 0xcbf06e9d, 0xb19da7d8, 0xa23f3faf, 0x96d89736, 0x857a0f41,
+        0x620305bc, 0x71a19dcb, 0x45463552, 0x56e4ad25, 0x2c896460, 0x3f2bfc17, 0x0bcc548e, 0x186eccf9,
+        0xc0d23785, 0xd370aff2, 0xe797076b, 0xf4359f1c, 0x8e585659, 0x9dface2e, 0xa91d66b7, 0xbabffec0,
+        0x5dc6f43d, 0x4e646c4a, 0x7a83c4d3, 0x69215ca4, 0x134c95e1, 0x00ee0d96, 0x3409a50f, 0x27ab3d78,
+        0x809c2506, 0x933ebd71, 0xa7d915e8, 0xb47b8d9f, 0xce1644da, 0xddb4dcad, 0xe9537434, 0xfaf1ec43,
+        0x1d88e6be, 0x0e2a7ec9, 0x3acdd650, 0x296f4e27, 0x53028762, 0x40a01f15, 0x7447b78c, 0x67e52ffb,
+        0xbf59d487, 0xacfb4cf0, 0x981ce469, 0x8bbe7c1e, 0xf1d3b55b, 0xe2712d2c, 0xd69685b5, 0xc5341dc2,
+        0x224d173f, 0x31ef8f48, 0x050827d1, 0x16aabfa6, 0x6cc776e3, 0x7f65ee94, 0x4b82460d, 0x5820de7a,
+        0xfbc3faf9, 0xe861628e, 0xdc86ca17, 0xcf245260, 0xb5499b25, 0xa6eb0352, 0x920cabcb, 0x81ae33bc,
+        0x66d73941, 0x7575a136, 0x419209af, 0x523091d8, 0x285d589d, 0x3bffc0ea, 0x0f186873, 0x1cbaf004,
+        0xc4060b78, 0xd7a4930f, 0xe3433b96, 0xf0e1a3e1, 0x8a8c6aa4, 0x992ef2d3, 0xadc95a4a, 0xbe6bc23d,
+        0x5912c8c0, 0x4ab050b7, 0x7e57f82e, 0x6df56059, 0x1798a91c, 0x043a316b, 0x30dd99f2, 0x237f0185,
+        0x844819fb, 0x97ea818c, 0xa30d2915, 0xb0afb162, 0xcac27827, 0xd960e050, 0xed8748c9, 0xfe25d0be,
+        0x195cda43, 0x0afe4234, 0x3e19eaad, 0x2dbb72da, 0x57d6bb9f, 0x447423e8, 0x70938b71, 0x63311306,
+        0xbb8de87a, 0xa82f700d, 0x9cc8d894, 0x8f6a40e3, 0xf50789a6, 0xe6a511d1, 0xd242b948, 0xc1e0213f,
+        0x26992bc2, 0x353bb3b5, 0x01dc1b2c, 0x127e835b, 0x68134a1e, 0x7bb1d269, 0x4f567af0, 0x5cf4e287,
+        0x04d43cfd, 0x1776a48a, 0x23910c13, 0x30339464, 0x4a5e5d21, 0x59fcc556, 0x6d1b6dcf, 0x7eb9f5b8,
+        0x99c0ff45, 0x8a626732, 0xbe85cfab, 0xad2757dc, 0xd74a9e99, 0xc4e806ee, 0xf00fae77, 0xe3ad3600,
+        0x3b11cd7c, 0x28b3550b, 0x1c54fd92, 0x0ff665e5, 0x759baca0, 0x663934d7, 0x52de9c4e, 0x417c0439,
+        0xa6050ec4, 0xb5a796b3, 0x81403e2a, 0x92e2a65d, 0xe88f6f18, 0xfb2df76f, 0xcfca5ff6, 0xdc68c781,
+        0x7b5fdfff, 0x68fd4788, 0x5c1aef11, 0x4fb87766, 0x35d5be23, 0x26772654, 0x12908ecd, 0x013216ba,
+        0xe64b1c47, 0xf5e98430, 0xc10e2ca9, 0xd2acb4de, 0xa8c17d9b, 0xbb63e5ec, 0x8f844d75, 0x9c26d502,
+        0x449a2e7e, 0x5738b609, 0x63df1e90, 0x707d86e7, 0x0a104fa2, 0x19b2d7d5, 0x2d557f4c, 0x3ef7e73b,
+        0xd98eedc6, 0xca2c75b1, 0xfecbdd28, 0xed69455f, 0x97048c1a, 0x84a6146d, 0xb041bcf4, 0xa3e32483,
+    },
+    {
+        0x00000000, 0xa541927e, 0x4f6f520d, 0xea2ec073, 0x9edea41a, 0x3b9f3664, 0xd1b1f617, 0x74f06469,
+        0x38513ec5, 0x9d10acbb, 0x773e6cc8, 0xd27ffeb6, 0xa68f9adf, 0x03ce08a1, 0xe9e0c8d2, 0x4ca15aac,
+        0x70a27d8a, 0xd5e3eff4, 0x3fcd2f87, 0x9a8cbdf9, 0xee7cd990, 0x4b3d4bee, 0xa1138b9d, 0x045219e3,
+        0x48f3434f, 0xedb2d131, 0x079c1142, 0xa2dd833c, 0xd62de755, 0x736c752b, 0x9942b558, 0x3c032726,
+        0xe144fb14, 0x4405696a, 0xae2ba919, 0x0b6a3b67, 0x7f9a5f0e, 0xdadbcd70, 0x30f50d03, 0x95b49f7d,
+        0xd915c5d1, 0x7c5457af, 0x967a97dc, 0x333b05a2, 0x47cb61cb, 0xe28af3b5, 0x08a433c6, 0xade5a1b8,
+        0x91e6869e, 0x34a714e0, 0xde89d493, 0x7bc846ed, 0x0f382284, 0xaa79b0fa, 0x40577089, 0xe516e2f7,
+        0xa9b7b85b, 0x0cf62a25, 0xe6d8ea56, 0x43997828, 0x37691c41, 0x92288e3f, 0x78064e4c, 0xdd47dc32,
+        0xc76580d9, 0x622412a7, 0x880ad2d4, 0x2d4b40aa, 0x59bb24c3, 0xfcfab6bd, 0x16d476ce, 0xb395e4b0,
+        0xff34be1c, 0x5a752c62, 0xb05bec11, 0x151a7e6f, 0x61ea1a06, 0xc4ab8878, 0x2e85480b, 0x8bc4da75,
+        0xb7c7fd53, 0x12866f2d, 0xf8a8af5e, 0x5de93d20, 0x29195949, 0x8c58cb37, 0x66760b44, 0xc337993a,
+        0x8f96c396, 0x2ad751e8, 0xc0f9919b, 0x65b803e5, 0x1148678c, 0xb409f5f2, 0x5e273581, 0xfb66a7ff,
+        0x26217bcd, 0x8360e9b3, 0x694e29c0, 0xcc0fbbbe, 0xb8ffdfd7, 0x1dbe4da9, 0xf7908dda, 0x52d11fa4,
+        0x1e704508, 0xbb31d776, 0x511f1705, 0xf45e857b, 0x80aee112, 0x25ef736c, 0xcfc1b31f, 0x6a802161,
+        0x56830647, 0xf3c29439, 0x19ec544a, 0xbcadc634, 0xc85da25d, 0x6d1c3023, 0x8732f050, 0x2273622e,
+        0x6ed23882, 0xcb93aafc, 0x21bd6a8f, 0x84fcf8f1, 0xf00c9c98, 0x554d0ee6, 0xbf63ce95, 0x1a225ceb,
+        0x8b277743, 0x2e66e53d, 0xc448254e, 0x6109b730, 0x15f9d359, 0xb0b84127, 0x5a968154, 0xffd7132a,
+        0xb3764986, 0x1637dbf8, 0xfc191b8b, 0x595889f5, 0x2da8ed9c, 0x88e97fe2, 0x62c7bf91, 0xc7862def,
+        0xfb850ac9, 0x5ec498b7, 0xb4ea58c4, 0x11abcaba, 0x655baed3, 0xc01a3cad, 0x2a34fcde, 0x8f756ea0,
+        0xc3d4340c, 0x6695a672, 0x8cbb6601, 0x29faf47f, 0x5d0a9016, 0xf84b0268, 0x1265c21b, 0xb7245065,
+        0x6a638c57, 0xcf221e29, 0x250cde5a, 0x804d4c24, 0xf4bd284d, 0x51fcba33, 0xbbd27a40, 0x1e93e83e,
+        0x5232b292, 0xf77320ec, 0x1d5de09f, 0xb81c72e1, 0xccec1688, 0x69ad84f6, 0x83834485, 0x26c2d6fb,
+        0x1ac1f1dd, 0xbf8063a3, 0x55aea3d0, 0xf0ef31ae, 0x841f55c7, 0x215ec7b9, 0xcb7007ca, 0x6e3195b4,
+        0x2290cf18, 0x87d15d66, 0x6dff9d15, 0xc8be0f6b, 0xbc4e6b02, 0x190ff97c, 0xf321390f, 0x5660ab71,
+        0x4c42f79a, 0xe90365e4, 0x032da597, 0xa66c37e9, 0xd29c5380, 0x77ddc1fe, 0x9df3018d, 0x38b293f3,
+        0x7413c95f, 0xd1525b21, 0x3b7c9b52, 0x9e3d092c, 0xeacd6d45, 0x4f8cff3b, 0xa5a23f48, 0x00e3ad36,
+        0x3ce08a10, 0x99a1186e, 0x738fd81d, 0xd6ce4a63, 0xa23e2e0a, 0x077fbc74, 0xed517c07, 0x4810ee79,
+        0x04b1b4d5, 0xa1f026ab, 0x4bdee6d8, 0xee9f74a6, 0x9a6f10cf, 0x3f2e82b1, 0xd50042c2, 0x7041d0bc,
+        0xad060c8e, 0x08479ef0, 0xe2695e83, 0x4728ccfd, 0x33d8a894, 0x96993aea, 0x7cb7fa99, 0xd9f668e7,
+        0x9557324b, 0x3016a035, 0xda386046, 0x7f79f238, 0x0b899651, 0xaec8042f, 0x44e6c45c, 0xe1a75622,
+        0xdda47104, 0x78e5e37a, 0x92cb2309, 0x378ab177, 0x437ad51e, 0xe63b4760, 0x0c158713, 0xa954156d,
+        0xe5f54fc1, 0x40b4ddbf, 0xaa9a1dcc, 0x0fdb8fb2, 0x7b2bebdb, 0xde6a79a5, 0x3444b9d6, 0x91052ba8,
+    },
+    {
+        0x00000000, 0xdd45aab8, 0xbf672381, 0x62228939, 0x7b2231f3, 0xa6679b4b, 0xc4451272, 0x1900b8ca,
+        0xf64463e6, 0x2b01c95e, 0x49234067, 0x9466eadf, 0x8d665215, 0x5023f8ad, 0x32017194, 0xef44db2c,
+        0xe964b13d, 0x34211b85, 0x560392bc, 0x8b463804, 0x924680ce, 0x4f032a76, 0x2d21a34f, 0xf06409f7,
+        0x1f20d2db, 0xc2657863, 0xa047f15a, 0x7d025be2, 0x6402e328, 0xb9474990, 0xdb65c0a9, 0x06206a11,
+        0xd725148b, 0x0a60be33, 0x6842370a, 0xb5079db2, 0xac072578, 0x71428fc0, 0x136006f9, 0xce25ac41,
+        0x2161776d, 0xfc24ddd5, 0x9e0654ec, 0x4343fe54, 0x5a43469e, 0x8706ec26, 0xe524651f, 0x3861cfa7,
+        0x3e41a5b6, 0xe3040f0e, 0x81268637, 0x5c632c8f, 0x45639445, 0x98263efd, 0xfa04b7c4, 0x27411d7c,
+        0xc805c650, 0x15406ce8, 0x7762e5d1, 0xaa274f69, 0xb327f7a3, 0x6e625d1b, 0x0c40d422, 0xd1057e9a,
+        0xaba65fe7, 0x76e3f55f, 0x14c17c66, 0xc984d6de, 0xd0846e14, 0x0dc1c4ac, 0x6fe34d95, 0xb2a6e72d,
+        0x5de23c01, 0x80a796b9, 0xe2851f80, 0x3fc0b538, 0x26c00df2, 0xfb85a74a, 0x99a72e73, 0x44e284cb,
+        0x42c2eeda, 0x9f874462, 0xfda5cd5b, 0x20e067e3, 0x39e0df29, 0xe4a57591, 0x8687fca8, 0x5bc25610,
+        0xb4868d3c, 0x69c32784, 0x0be1aebd, 0xd6a40405, 0xcfa4bccf, 0x12e11677, 0x70c39f4e, 0xad8635f6,
+        0x7c834b6c, 0xa1c6e1d4, 0xc3e468ed, 0x1ea1c255, 0x07a17a9f, 0xdae4d027, 0xb8c6591e, 0x6583f3a6,
+        0x8ac7288a, 0x57828232, 0x35a00b0b, 0xe8e5a1b3, 0xf1e51979, 0x2ca0b3c1, 0x4e823af8, 0x93c79040,
+        0x95e7fa51, 0x48a250e9, 0x2a80d9d0, 0xf7c57368, 0xeec5cba2, 0x3380611a, 0x51a2e823, 0x8ce7429b,
+        0x63a399b7, 0xbee6330f, 0xdcc4ba36, 0x0181108e, 0x1881a844, 0xc5c402fc, 0xa7e68bc5, 0x7aa3217d,
+        0x52a0c93f, 0x8fe56387, 0xedc7eabe, 0x30824006, 0x2982f8cc, 0xf4c75274, 0x96e5db4d, 0x4ba071f5,
+        0xa4e4aad9, 0x79a10061, 0x1b838958, 0xc6c623e0, 0xdfc69b2a, 0x02833192, 0x60a1b8ab, 0xbde41213,
+        0xbbc47802, 0x6681d2ba, 0x04a35b83, 0xd9e6f13b, 0xc0e649f1, 0x1da3e349, 0x7f816a70, 0xa2c4c0c8,
+        0x4d801be4, 0x90c5b15c, 0xf2e73865, 0x2fa292dd, 0x36a22a17, 0xebe780af, 0x89c50996, 0x5480a32e,
+        0x8585ddb4, 0x58c0770c, 0x3ae2fe35, 0xe7a7548d, 0xfea7ec47, 0x23e246ff, 0x41c0cfc6, 0x9c85657e,
+        0x73c1be52, 0xae8414ea, 0xcca69dd3, 0x11e3376b, 0x08e38fa1, 0xd5a62519, 0xb784ac20, 0x6ac10698,
+        0x6ce16c89, 0xb1a4c631, 0xd3864f08, 0x0ec3e5b0, 0x17c35d7a, 0xca86f7c2, 0xa8a47efb, 0x75e1d443,
+        0x9aa50f6f, 0x47e0a5d7, 0x25c22cee, 0xf8878656, 0xe1873e9c, 0x3cc29424, 0x5ee01d1d, 0x83a5b7a5,
+        0xf90696d8, 0x24433c60, 0x4661b559, 0x9b241fe1, 0x8224a72b, 0x5f610d93, 0x3d4384aa, 0xe0062e12,
+        0x0f42f53e, 0xd2075f86, 0xb025d6bf, 0x6d607c07, 0x7460c4cd, 0xa9256e75, 0xcb07e74c, 0x16424df4,
+        0x106227e5, 0xcd278d5d, 0xaf050464, 0x7240aedc, 0x6b401616, 0xb605bcae, 0xd4273597, 0x09629f2f,
+        0xe6264403, 0x3b63eebb, 0x59416782, 0x8404cd3a, 0x9d0475f0, 0x4041df48, 0x22635671, 0xff26fcc9,
+        0x2e238253, 0xf36628eb, 0x9144a1d2, 0x4c010b6a, 0x5501b3a0, 0x88441918, 0xea669021, 0x37233a99,
+        0xd867e1b5, 0x05224b0d, 0x6700c234, 0xba45688c, 0xa345d046, 0x7e007afe, 0x1c22f3c7, 0xc167597f,
+        0xc747336e, 0x1a0299d6, 0x782010ef, 0xa565ba57, 0xbc65029d, 0x6120a825, 0x0302211c, 0xde478ba4,
+        0x31035088, 0xec46fa30, 0x8e647309, 0x5321d9b1, 0x4a21617b, 0x9764cbc3, 0xf54642fa, 0x2803e842,
+    },
+    {
+        0x00000000, 0x38116fac, 0x7022df58, 0x4833b0f4, 0xe045beb0, 0xd854d11c, 0x906761e8, 0xa8760e44,
+        0xc5670b91, 0xfd76643d, 0xb545d4c9, 0x8d54bb65, 0x2522b521, 0x1d33da8d, 0x55006a79, 0x6d1105d5,
+        0x8f2261d3, 0xb7330e7f, 0xff00be8b, 0xc711d127, 0x6f67df63, 0x5776b0cf, 0x1f45003b, 0x27546f97,
+        0x4a456a42, 0x725405ee, 0x3a67b51a, 0x0276dab6, 0xaa00d4f2, 0x9211bb5e, 0xda220baa, 0xe2336406,
+        0x1ba8b557, 0x23b9dafb, 0x6b8a6a0f, 0x539b05a3, 0xfbed0be7, 0xc3fc644b, 0x8bcfd4bf, 0xb3debb13,
+        0xdecfbec6, 0xe6ded16a, 0xaeed619e, 0x96fc0e32, 0x3e8a0076, 0x069b6fda, 0x4ea8df2e, 0x76b9b082,
+        0x948ad484, 0xac9bbb28, 0xe4a80bdc, 0xdcb96470, 0x74cf6a34, 0x4cde0598, 0x04edb56c, 0x3cfcdac0,
+        0x51eddf15, 0x69fcb0b9, 0x21cf004d, 0x19de6fe1, 0xb1a861a5, 0x89b90e09, 0xc18abefd, 0xf99bd151,
+        0x37516aae, 0x0f400502, 0x4773b5f6, 0x7f62da5a, 0xd714d41e, 0xef05bbb2, 0xa7360b46, 0x9f2764ea,
+        0xf236613f, 0xca270e93, 0x8214be67, 0xba05d1cb, 0x1273df8f, 0x2a62b023, 0x625100d7, 0x5a406f7b,
+        0xb8730b7d, 0x806264d1, 0xc851d425, 0xf040bb89, 0x5836b5cd, 0x6027da61, 0x28146a95, 0x10050539,
+        0x7d1400ec, 0x45056f40, 0x0d36dfb4, 0x3527b018, 0x9d51be5c, 0xa540d1f0, 0xed736104, 0xd5620ea8,
+        0x2cf9dff9, 0x14e8b055, 0x5cdb00a1, 0x64ca6f0d, 0xccbc6149, 0xf4ad0ee5, 0xbc9ebe11, 0x848fd1bd,
+        0xe99ed468, 0xd18fbbc4, 0x99bc0b30, 0xa1ad649c, 0x09db6ad8, 0x31ca0574, 0x79f9b580, 0x41e8da2c,
+        0xa3dbbe2a, 0x9bcad186, 0xd3f96172, 0xebe80ede, 0x439e009a, 0x7b8f6f36, 0x33bcdfc2, 0x0badb06e,
+        0x66bcb5bb, 0x5eadda17, 0x169e6ae3, 0x2e8f054f, 0x86f90b0b, 0xbee864a7, 0xf6dbd453, 0xcecabbff,
+        0x6ea2d55c, 0x56b3baf0, 0x1e800a04, 0x269165a8, 0x8ee76bec, 0xb6f60440, 0xfec5b4b4, 0xc6d4db18,
+        0xabc5decd, 0x93d4b161, 0xdbe70195, 0xe3f66e39, 0x4b80607d, 0x73910fd1, 0x3ba2bf25, 0x03b3d089,
+        0xe180b48f, 0xd991db23, 0x91a26bd7, 0xa9b3047b, 0x01c50a3f, 0x39d46593, 0x71e7d567, 0x49f6bacb,
+        0x24e7bf1e, 0x1cf6d0b2, 0x54c56046, 0x6cd40fea, 0xc4a201ae, 0xfcb36e02, 0xb480def6, 0x8c91b15a,
+        0x750a600b, 0x4d1b0fa7, 0x0528bf53, 0x3d39d0ff, 0x954fdebb, 0xad5eb117, 0xe56d01e3, 0xdd7c6e4f,
+        0xb06d6b9a, 0x887c0436, 0xc04fb4c2, 0xf85edb6e, 0x5028d52a, 0x6839ba86, 0x200a0a72, 0x181b65de,
+        0xfa2801d8, 0xc2396e74, 0x8a0ade80, 0xb21bb12c, 0x1a6dbf68, 0x227cd0c4, 0x6a4f6030, 0x525e0f9c,
+        0x3f4f0a49, 0x075e65e5, 0x4f6dd511, 0x777cbabd, 0xdf0ab4f9, 0xe71bdb55, 0xaf286ba1, 0x9739040d,
+        0x59f3bff2, 0x61e2d05e, 0x29d160aa, 0x11c00f06, 0xb9b60142, 0x81a76eee, 0xc994de1a, 0xf185b1b6,
+        0x9c94b463, 0xa485dbcf, 0xecb66b3b, 0xd4a70497, 0x7cd10ad3, 0x44c0657f, 0x0cf3d58b, 0x34e2ba27,
+        0xd6d1de21, 0xeec0b18d, 0xa6f30179, 0x9ee26ed5, 0x36946091, 0x0e850f3d, 0x46b6bfc9, 0x7ea7d065,
+        0x13b6d5b0, 0x2ba7ba1c, 0x63940ae8, 0x5b856544, 0xf3f36b00, 0xcbe204ac, 0x83d1b458, 0xbbc0dbf4,
+        0x425b0aa5, 0x7a4a6509, 0x3279d5fd, 0x0a68ba51, 0xa21eb415, 0x9a0fdbb9, 0xd23c6b4d, 0xea2d04e1,
+        0x873c0134, 0xbf2d6e98, 0xf71ede6c, 0xcf0fb1c0, 0x6779bf84, 0x5f68d028, 0x175b60dc, 0x2f4a0f70,
+        0xcd796b76, 0xf56804da, 0xbd5bb42e, 0x854adb82, 0x2d3cd5c6, 0x152dba6a, 0x5d1e0a9e, 0x650f6532,
+        0x081e60e7, 0x300f0f4b, 0x783cbfbf, 0x402dd013, 0xe85bde57, 0xd04ab1fb, 0x9879010f, 0xa0686ea3,
+    },
+    {
+        0x00000000, 0xef306b19, 0xdb8ca0c3, 0x34bccbda, 0xb2f53777, 0x5dc55c6e, 0x697997b4, 0x8649fcad,
+        0x6006181f, 0x8f367306, 0xbb8ab8dc, 0x54bad3c5, 0xd2f32f68, 0x3dc34471, 0x097f8fab, 0xe64fe4b2,
+        0xc00c303e, 0x2f3c5b27, 0x1b8090fd, 0xf4b0fbe4, 0x72f90749, 0x9dc96c50, 0xa975a78a, 0x4645cc93,
+        0xa00a2821, 0x4f3a4338, 0x7b8688e2, 0x94b6e3fb, 0x12ff1f56, 0xfdcf744f, 0xc973bf95, 0x2643d48c,
+        0x85f4168d, 0x6ac47d94, 0x5e78b64e, 0xb148dd57, 0x370121fa, 0xd8314ae3, 0xec8d8139, 0x03bdea20,
+        0xe5f20e92, 0x0ac2658b, 0x3e7eae51, 0xd14ec548, 0x570739e5, 0xb83752fc, 0x8c8b9926, 0x63bbf23f,
+        0x45f826b3, 0xaac84daa, 0x9e748670, 0x7144ed69, 0xf70d11c4, 0x183d7add, 0x2c81b107, 0xc3b1da1e,
+        0x25fe3eac, 0xcace55b5, 0xfe729e6f, 0x1142f576, 0x970b09db, 0x783b62c2, 0x4c87a918, 0xa3b7c201,
+        0x0e045beb, 0xe13430f2, 0xd588fb28, 0x3ab89031, 0xbcf16c9c, 0x53c10785, 0x677dcc5f, 0x884da746,
+        0x6e0243f4, 0x813228ed, 0xb58ee337, 0x5abe882e, 0xdcf77483, 0x33c71f9a, 0x077bd440, 0xe84bbf59,
+        0xce086bd5, 0x213800cc, 0x1584cb16, 0xfab4a00f, 0x7cfd5ca2, 0x93cd37bb, 0xa771fc61, 0x48419778,
+        0xae0e73ca, 0x413e18d3, 0x7582d309, 0x9ab2b810, 0x1cfb44bd, 0xf3cb2fa4, 0xc777e47e, 0x28478f67,
+        0x8bf04d66, 0x64c0267f, 0x507ceda5, 0xbf4c86bc, 0x39057a11, 0xd6351108, 0xe289dad2, 0x0db9b1cb,
+        0xebf65579, 0x04c63e60, 0x307af5ba, 0xdf4a9ea3, 0x5903620e, 0xb6330917, 0x828fc2cd, 0x6dbfa9d4,
+        0x4bfc7d58, 0xa4cc1641, 0x9070dd9b, 0x7f40b682, 0xf9094a2f, 0x16392136, 0x2285eaec, 0xcdb581f5,
+        0x2bfa6547, 0xc4ca0e5e, 0xf076c584, 0x1f46ae9d, 0x990f5230, 0x763f3929, 0x4283f2f3, 0xadb399ea,
+        0x1c08b7d6, 0xf338dccf, 0xc7841715, 0x28b47c0c, 0xaefd80a1, 0x41cdebb8, 0x75712062, 0x9a414b7b,
+        0x7c0eafc9, 0x933ec4d0, 0xa7820f0a, 0x48b26413, 0xcefb98be, 0x21cbf3a7, 0x1577387d, 0xfa475364,
+        0xdc0487e8, 0x3334ecf1, 0x0788272b, 0xe8b84c32, 0x6ef1b09f, 0x81c1db86, 0xb57d105c, 0x5a4d7b45,
+        0xbc029ff7, 0x5332f4ee, 0x678e3f34, 0x88be542d, 0x0ef7a880, 0xe1c7c399, 0xd57b0843, 0x3a4b635a,
+        0x99fca15b, 0x76ccca42, 0x42700198, 0xad406a81, 0x2b09962c, 0xc439fd35, 0xf08536ef, 0x1fb55df6,
+        0xf9fab944, 0x16cad25d, 0x22761987, 0xcd46729e, 0x4b0f8e33, 0xa43fe52a, 0x90832ef0, 0x7fb345e9,
+        0x59f09165, 0xb6c0fa7c, 0x827c31a6, 0x6d4c5abf, 0xeb05a612, 0x0435cd0b, 0x308906d1, 0xdfb96dc8,
+        0x39f6897a, 0xd6c6e263, 0xe27a29b9, 0x0d4a42a0, 0x8b03be0d, 0x6433d514, 0x508f1ece, 0xbfbf75d7,
+        0x120cec3d, 0xfd3c8724, 0xc9804cfe, 0x26b027e7, 0xa0f9db4a, 0x4fc9b053, 0x7b757b89, 0x94451090,
+        0x720af422, 0x9d3a9f3b, 0xa98654e1, 0x46b63ff8, 0xc0ffc355, 0x2fcfa84c, 0x1b736396, 0xf443088f,
+        0xd200dc03, 0x3d30b71a, 0x098c7cc0, 0xe6bc17d9, 0x60f5eb74, 0x8fc5806d, 0xbb794bb7, 0x544920ae,
+        0xb206c41c, 0x5d36af05, 0x698a64df, 0x86ba0fc6, 0x00f3f36b, 0xefc39872, 0xdb7f53a8, 0x344f38b1,
+        0x97f8fab0, 0x78c891a9, 0x4c745a73, 0xa344316a, 0x250dcdc7, 0xca3da6de, 0xfe816d04, 0x11b1061d,
+        0xf7fee2af, 0x18ce89b6, 0x2c72426c, 0xc3422975, 0x450bd5d8, 0xaa3bbec1, 0x9e87751b, 0x71b71e02,
+        0x57f4ca8e, 0xb8c4a197, 0x8c786a4d, 0x63480154, 0xe501fdf9, 0x0a3196e0, 0x3e8d5d3a, 0xd1bd3623,
+        0x37f2d291, 0xd8c2b988, 0xec7e7252, 0x034e194b, 0x8507e5e6, 0x6a378eff, 0x5e8b4525, 0xb1bb2e3c,
+    },
+    {
+        0x00000000, 0x68032cc8, 0xd0065990, 0xb8057558, 0xa5e0c5d1, 0xcde3e919, 0x75e69c41, 0x1de5b089,
+        0x4e2dfd53, 0x262ed19b, 0x9e2ba4c3, 0xf628880b, 0xebcd3882, 0x83ce144a, 0x3bcb6112, 0x53c84dda,
+        0x9c5bfaa6, 0xf458d66e, 0x4c5da336, 0x245e8ffe, 0x39bb3f77, 0x51b813bf, 0xe9bd66e7, 0x81be4a2f,
+        0xd27607f5, 0xba752b3d, 0x02705e65, 0x6a7372ad, 0x7796c224, 0x1f95eeec, 0xa7909bb4, 0xcf93b77c,
+        0x3d5b83bd, 0x5558af75, 0xed5dda2d, 0x855ef6e5, 0x98bb466c, 0xf0b86aa4, 0x48bd1ffc, 0x20be3334,
+        0x73767eee, 0x1b755226, 0xa370277e, 0xcb730bb6, 0xd696bb3f, 0xbe9597f7, 0x0690e2af, 0x6e93ce67,
+        0xa100791b, 0xc90355d3, 0x7106208b, 0x19050c43, 0x04e0bcca, 0x6ce39002, 0xd4e6e55a, 0xbce5c992,
+        0xef2d8448, 0x872ea880, 0x3f2bddd8, 0x5728f110, 0x4acd4199, 0x22ce6d51, 0x9acb1809, 0xf2c834c1,
+        0x7ab7077a, 0x12b42bb2, 0xaab15eea, 0xc2b27222, 0xdf57c2ab, 0xb754ee63, 0x0f519b3b, 0x6752b7f3,
+        0x349afa29, 0x5c99d6e1, 0xe49ca3b9, 0x8c9f8f71, 0x917a3ff8, 0xf9791330, 0x417c6668, 0x297f4aa0,
+        0xe6ecfddc, 0x8eefd114, 0x36eaa44c, 0x5ee98884, 0x430c380d, 0x2b0f14c5, 0x930a619d, 0xfb094d55,
+        0xa8c1008f, 0xc0c22c47, 0x78c7591f, 0x10c475d7, 0x0d21c55e, 0x6522e996, 0xdd279cce, 0xb524b006,
+        0x47ec84c7, 0x2fefa80f, 0x97eadd57, 0xffe9f19f, 0xe20c4116, 0x8a0f6dde, 0x320a1886, 0x5a09344e,
+        0x09c17994, 0x61c2555c, 0xd9c72004, 0xb1c40ccc, 0xac21bc45, 0xc422908d, 0x7c27e5d5, 0x1424c91d,
+        0xdbb77e61, 0xb3b452a9, 0x0bb127f1, 0x63b20b39, 0x7e57bbb0, 0x16549778, 0xae51e220, 0xc652cee8,
+        0x959a8332, 0xfd99affa, 0x459cdaa2, 0x2d9ff66a, 0x307a46e3, 0x58796a2b, 0xe07c1f73, 0x887f33bb,
+        0xf56e0ef4, 0x9d6d223c, 0x25685764, 0x4d6b7bac, 0x508ecb25, 0x388de7ed, 0x808892b5, 0xe88bbe7d,
+        0xbb43f3a7, 0xd340df6f, 0x6b45aa37, 0x034686ff, 0x1ea33676, 0x76a01abe, 0xcea56fe6, 0xa6a6432e,
+        0x6935f452, 0x0136d89a, 0xb933adc2, 0xd130810a, 0xccd53183, 0xa4d61d4b, 0x1cd36813, 0x74d044db,
+        0x27180901, 0x4f1b25c9, 0xf71e5091, 0x9f1d7c59, 0x82f8ccd0, 0xeafbe018, 0x52fe9540, 0x3afdb988,
+        0xc8358d49, 0xa036a181, 0x1833d4d9, 0x7030f811, 0x6dd54898, 0x05d66450, 0xbdd31108, 0xd5d03dc0,
+        0x8618701a, 0xee1b5cd2, 0x561e298a, 0x3e1d0542, 0x23f8b5cb, 0x4bfb9903, 0xf3feec5b, 0x9bfdc093,
+        0x546e77ef, 0x3c6d5b27, 0x84682e7f, 0xec6b02b7, 0xf18eb23e, 0x998d9ef6, 0x2188ebae, 0x498bc766,
+        0x1a438abc, 0x7240a674, 0xca45d32c, 0xa246ffe4, 0xbfa34f6d, 0xd7a063a5, 0x6fa516fd, 0x07a63a35,
+        0x8fd9098e, 0xe7da2546, 0x5fdf501e, 0x37dc7cd6, 0x2a39cc5f, 0x423ae097, 0xfa3f95cf, 0x923cb907,
+        0xc1f4f4dd, 0xa9f7d815, 0x11f2ad4d, 0x79f18185, 0x6414310c, 0x0c171dc4, 0xb412689c, 0xdc114454,
+        0x1382f328, 0x7b81dfe0, 0xc384aab8, 0xab878670, 0xb66236f9, 0xde611a31, 0x66646f69, 0x0e6743a1,
+        0x5daf0e7b, 0x35ac22b3, 0x8da957eb, 0xe5aa7b23, 0xf84fcbaa, 0x904ce762, 0x2849923a, 0x404abef2,
+        0xb2828a33, 0xda81a6fb, 0x6284d3a3, 0x0a87ff6b, 0x17624fe2, 0x7f61632a, 0xc7641672, 0xaf673aba,
+        0xfcaf7760, 0x94ac5ba8, 0x2ca92ef0, 0x44aa0238, 0x594fb2b1, 0x314c9e79, 0x8949eb21, 0xe14ac7e9,
+        0x2ed97095, 0x46da5c5d, 0xfedf2905, 0x96dc05cd, 0x8b39b544, 0xe33a998c, 0x5b3fecd4, 0x333cc01c,
+        0x60f48dc6, 0x08f7a10e, 0xb0f2d456, 0xd8f1f89e, 0xc5144817, 0xad1764df, 0x15121187, 0x7d113d4f,
+    },
+    {
+        0x00000000, 0x493c7d27, 0x9278fa4e, 0xdb448769, 0x211d826d, 0x6821ff4a, 0xb3657823, 0xfa590504,
+        0x423b04da, 0x0b0779fd, 0xd043fe94, 0x997f83b3, 0x632686b7, 0x2a1afb90, 0xf15e7cf9, 0xb86201de,
+        0x847609b4, 0xcd4a7493, 0x160ef3fa, 0x5f328edd, 0xa56b8bd9, 0xec57f6fe, 0x37137197, 0x7e2f0cb0,
+        0xc64d0d6e, 0x8f717049, 0x5435f720, 0x1d098a07, 0xe7508f03, 0xae6cf224, 0x7528754d, 0x3c14086a,
+        0x0d006599, 0x443c18be, 0x9f789fd7, 0xd644e2f0, 0x2c1de7f4, 0x65219ad3, 0xbe651dba, 0xf759609d,
+        0x4f3b6143, 0x06071c64, 0xdd439b0d, 0x947fe62a, 0x6e26e32e, 0x271a9e09, 0xfc5e1960, 0xb5626447,
+        0x89766c2d, 0xc04a110a, 0x1b0e9663, 0x5232eb44, 0xa86bee40, 0xe1579367, 0x3a13140e, 0x732f6929,
+        0xcb4d68f7, 0x827115d0, 0x593592b9, 0x1009ef9e, 0xea50ea9a, 0xa36c97bd, 0x782810d4, 0x31146df3,
+        0x1a00cb32, 0x533cb615, 0x8878317c, 0xc1444c5b, 0x3b1d495f, 0x72213478, 0xa965b311, 0xe059ce36,
+        0x583bcfe8, 0x1107b2cf, 0xca4335a6, 0x837f4881, 0x79264d85, 0x301a30a2, 0xeb5eb7cb, 0xa262caec,
+        0x9e76c286, 0xd74abfa1, 0x0c0e38c8, 0x453245ef, 0xbf6b40eb, 0xf6573dcc, 0x2d13baa5, 0x642fc782,
+        0xdc4dc65c, 0x9571bb7b, 0x4e353c12, 0x07094135, 0xfd504431, 0xb46c3916, 0x6f28be7f, 0x2614c358,
+        0x1700aeab, 0x5e3cd38c, 0x857854e5, 0xcc4429c2, 0x361d2cc6, 0x7f2151e1, 0xa465d688, 0xed59abaf,
+        0x553baa71, 0x1c07d756, 0xc743503f, 0x8e7f2d18, 0x7426281c, 0x3d1a553b, 0xe65ed252, 0xaf62af75,
+        0x9376a71f, 0xda4ada38, 0x010e5d51, 0x48322076, 0xb26b2572, 0xfb575855, 0x2013df3c, 0x692fa21b,
+        0xd14da3c5, 0x9871dee2, 0x4335598b, 0x0a0924ac, 0xf05021a8, 0xb96c5c8f, 0x6228dbe6, 0x2b14a6c1,
+        0x34019664, 0x7d3deb43, 0xa6796c2a, 0xef45110d, 0x151c1409, 0x5c20692e, 0x8764ee47, 0xce589360,
+        0x763a92be, 0x3f06ef99, 0xe44268f0, 0xad7e15d7, 0x572710d3, 0x1e1b6df4, 0xc55fea9d, 0x8c6397ba,
+        0xb0779fd0, 0xf94be2f7, 0x220f659e, 0x6b3318b9, 0x916a1dbd, 0xd856609a, 0x0312e7f3, 0x4a2e9ad4,
+        0xf24c9b0a, 0xbb70e62d, 0x60346144, 0x29081c63, 0xd3511967, 0x9a6d6440, 0x4129e329, 0x08159e0e,
+        0x3901f3fd, 0x703d8eda, 0xab7909b3, 0xe2457494, 0x181c7190, 0x51200cb7, 0x8a648bde, 0xc358f6f9,
+        0x7b3af727, 0x32068a00, 0xe9420d69, 0xa07e704e, 0x5a27754a, 0x131b086d, 0xc85f8f04, 0x8163f223,
+        0xbd77fa49, 0xf44b876e, 0x2f0f0007, 0x66337d20, 0x9c6a7824, 0xd5560503, 0x0e12826a, 0x472eff4d,
+        0xff4cfe93, 0xb67083b4, 0x6d3404dd, 0x240879fa, 0xde517cfe, 0x976d01d9, 0x4c2986b0, 0x0515fb97,
+        0x2e015d56, 0x673d2071, 0xbc79a718, 0xf545da3f, 0x0f1cdf3b, 0x4620a21c, 0x9d642575, 0xd4585852,
+        0x6c3a598c, 0x250624ab, 0xfe42a3c2, 0xb77edee5, 0x4d27dbe1, 0x041ba6c6, 0xdf5f21af, 0x96635c88,
+        0xaa7754e2, 0xe34b29c5, 0x380faeac, 0x7133d38b, 0x8b6ad68f, 0xc256aba8, 0x19122cc1, 0x502e51e6,
+        0xe84c5038, 0xa1702d1f, 0x7a34aa76, 0x3308d751, 0xc951d255, 0x806daf72, 0x5b29281b, 0x1215553c,
+        0x230138cf, 0x6a3d45e8, 0xb179c281, 0xf845bfa6, 0x021cbaa2, 0x4b20c785, 0x906440ec, 0xd9583dcb,
+        0x613a3c15, 0x28064132, 0xf342c65b, 0xba7ebb7c, 0x4027be78, 0x091bc35f, 0xd25f4436, 0x9b633911,
+        0xa777317b, 0xee4b4c5c, 0x350fcb35, 0x7c33b612, 0x866ab316, 0xcf56ce31, 0x14124958, 0x5d2e347f,
+        0xe54c35a1, 0xac704886, 0x7734cfef, 0x3e08b2c8, 0xc451b7cc, 0x8d6dcaeb, 0x56294d82, 0x1f1530a5,
+    },
+};
+#endif
+
+SVDEF uint32_t
+sv_crc32c(StringView sv, uint32_t seed) SV_NOEXCEPT
+{
+    const char *p   = sv.begin;
+    size_t      n   = sv.length;
+    uint32_t    crc = ~seed;
+
+#if SV_HAS_SSE42
+    crc = sv_crc32c_3way_(crc, &p, &n, SV_CRC32C_LONG_, 0x28461564u);
+#if SV_HAS_PCLMUL
+    crc = sv_crc32c_3way_(crc, &p, &n, SV_CRC32C_SHORT_, 0x88e56f72u);
+#endif
+    for (; n >= 8; p += 8, n -= 8) crc = sv_crc32c_word_(crc, p);
+    for (; n > 0; ++p, --n) crc = _mm_crc32_u8(crc, (unsigned char)*p);
+#else
+    const uint32_t(*t)[256] = sv_crc32c_table_;
+    for (; n >= 8; p += 8, n -= 8) {
+        const uint32_t lo = crc ^ (uint32_t)sv_load_le32_(p);
+        const uint32_t hi = (uint32_t)sv_load_le32_(p + 4);
+        crc = t[7][lo & 0xFF] ^ t[6][(lo >> 8) & 0xFF] ^ t[5][(lo >> 16) & 0xFF] ^ t[4][lo >> 24]
+            ^ t[3][hi & 0xFF] ^ t[2][(hi >> 8) & 0xFF] ^ t[1][(hi >> 16) & 0xFF] ^ t[0][hi >> 24];
+    }
+    for (; n > 0; ++p, --n) crc = t[0][(crc ^ (unsigned char)*p) & 0xFF] ^ (crc >> 8);
+#endif
+
+    return ~crc;
+}
+
+#if SV_HAS_SSE42
+#undef SV_CRC32C_LONG_
+#undef SV_CRC32C_SHORT_
+#endif
+
+#define SV_MAP_GROUP_   16
+#define SV_MAP_EMPTY_   0x80u
+#define SV_MAP_DELETED_ 0xFEu
+
+// Bit i set if ctrl[i] == b, for the 16 control bytes of a group
+static inline unsigned
+sv_map_match_(const unsigned char *ctrl, unsigned b)
+{
+#if SV_HAS_SSE2
+    const __m128i group = _mm_loadu_si128((const __m128i *)(const void *)ctrl);
+    return (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)b)));
+#else
+    // SWAR: the high bit of each byte ends up set iff the byte of x is zero,
+    // then a multiply gathers the 8 high bits into the top byte.
+    const uint64_t ones = 0x0101010101010101ULL, low7 = 0x7F7F7F7F7F7F7F7FULL;
+    unsigned       mask = 0;
+    for (int half = 0; half < 2; ++half) {
+        const uint64_t x = sv_load_le64_((const char *)ctrl + half * 8) ^ (b * ones);
+        const uint64_t z = ~(((x & low7) + low7) | x) & ~low7;
+        mask |= (unsigned)(((z >> 7) * 0x0102040810204080ULL) >> 56) << (half * 8);
+    }
+    return mask;
+#endif
+}
+
+// Bit i set if ctrl[i] is empty or deleted (high bit set)
+static inline unsigned
+sv_map_match_free_(const unsigned char *ctrl)
+{
+#if SV_HAS_SSE2
+    return (unsigned)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(const void *)ctrl));
+#else
+    unsigned mask = 0;
+    for (int half = 0; half < 2; ++half) {
+        const uint64_t z = sv_load_le64_((const char *)ctrl + half * 8) & 0x8080808080808080ULL;
+        mask |= (unsigned)(((z >> 7) * 0x0102040810204080ULL) >> 56) << (half * 8);
+    }
+    return mask;
+#endif
 }
 
-SVDEF StringView
-sv_drop_last(StringView sv, size_t n) SV_NOEXCEPT
+// Up to 7/8 of the slots are used before the table grows
+static inline size_t
+sv_map_max_load_(size_t capacity)
 {
-    SV_ASSERT(n <= sv.length);
-    return sv_substr(sv, 0, sv.length-n);
+    return capacity - capacity / 8;
 }
 
-SVDEF StringView
-sv_take_and_consume(StringView *sv, size_t n) SV_NOEXCEPT
+// Slot index of key, or SV_NPOS. Groups are probed quadratically (triangular
+// numbers, which visit every group of a power-of-two table), and a group with
+// an empty slot ends the search.
+static inline size_t
+sv_map_lookup_(const SvMap *map, StringView key, uint64_t hash)
 {
-    SV_ASSERT(n <= sv->length);
-
-    StringView out = sv_empty();
-    out.begin = sv->begin;
-    out.length = n;
-    sv->begin  += n;
-    sv->length -= n;
-    return out;
+    if (map->capacity == 0) return SV_NPOS;
+
+    const size_t group_mask = map->capacity / SV_MAP_GROUP_ - 1;
+    size_t       group      = (size_t)(hash >> 7) & group_mask;
+    for (size_t step = 1;; ++step) {
+        const unsigned char *ctrl  = map->ctrl + group * SV_MAP_GROUP_;
+        unsigned             match = sv_map_match_(ctrl, (unsigned)(hash & 0x7F));
+        while (match) {
+            const size_t     i    = group * SV_MAP_GROUP_ + sv_ctz32_(match);
+            const SvMapSlot *slot = &map->slots[i];
+            if (slot->hash == hash && sv_eq(slot->key, key)) return i;
+            match &= match - 1;
+        }
+        if (sv_map_match_(ctrl, SV_MAP_EMPTY_)) return SV_NPOS;
+        if (step > group_mask) return SV_NPOS;
+        group = (group + step) & group_mask;
+    }
 }
 
-SVDEF StringView
-sv_drop_and_consume(StringView *sv, size_t n) SV_NOEXCEPT
+// First empty or deleted slot on the probe sequence of hash. There always is one.
+static inline size_t
+sv_map_free_slot_(const SvMap *map, uint64_t hash)
 {
-    SV_ASSERT(n <= sv->length);
-
-    sv->begin  += n;
-    sv->length -= n;
-    return *sv;
+    const size_t group_mask = map->capacity / SV_MAP_GROUP_ - 1;
+    size_t       group      = (size_t)(hash >> 7) & group_mask;
+    for (size_t step = 1;; ++step) {
+        const unsigned match = sv_map_match_free_(map->ctrl + group * SV_MAP_GROUP_);
+        if (match) return group * SV_MAP_GROUP_ + sv_ctz32_(match);
+        group = (group + step) & group_mask;
+    }
 }
 
-SVDEF StringView
-sv_take_last_and_consume(StringView *sv, size_t n) SV_NOEXCEPT
+// Move every entry into a new table of new_capacity slots, dropping tombstones.
+// Stored hashes are reused, keys are not rehashed.
+static inline bool
+sv_map_rehash_(SvMap *map, size_t new_capacity)
 {
-    SV_ASSERT(n <= sv->length);
+    if (new_capacity > SIZE_MAX / (sizeof(SvMapSlot) + 1)) return false;
+    const size_t   ctrl_size = sv_align8_(new_capacity);
+    unsigned char *mem       = (unsigned char *)sv_alloc_(&map->allocator, ctrl_size + new_capacity * sizeof(SvMapSlot));
+    if (!mem) return false;
+
+    SvMap next       = *map;
+    next.ctrl        = mem;
+    next.slots       = (SvMapSlot *)(void *)(mem + ctrl_size);
+    next.capacity    = new_capacity;
+    next.growth_left = sv_map_max_load_(new_capacity) - map->count;
+    memset(next.ctrl, (int)SV_MAP_EMPTY_, new_capacity);
+
+    for (size_t i = 0; i < map->capacity; ++i) {
+        if (map->ctrl[i] & 0x80) continue;
+        const size_t j = sv_map_free_slot_(&next, map->slots[i].hash);
+        next.ctrl[j]   = map->ctrl[i];
+        next.slots[j]  = map->slots[i];
+    }
 
-    StringView out = sv_empty();
-    out.begin = sv->begin + (sv->length - n);
-    out.length = n;
-    sv->length -= n;
-    return out;
+    sv_dealloc_(&map->allocator, map->ctrl, sv_align8_(map->capacity) + map->capacity * sizeof(SvMapSlot));
+    *map = next;
+    return true;
 }
 
-SVDEF StringView
-sv_drop_last_and_consume(StringView *sv, size_t n) SV_NOEXCEPT
+SVDEF bool
+sv_map_init(SvMap *map, size_t capacity, uint64_t seed, const SvAllocator *allocator) SV_NOEXCEPT
 {
-    SV_ASSERT(n <= sv->length);
+    SV_ASSERT(map != NULL);
 
-    sv->length -= n;
-    return *sv;
+    memset(map, 0, sizeof *map);
+    if (allocator) map->allocator = *allocator;
+    map->seed = seed;
+    return sv_map_reserve(map, capacity);
 }
 
-
 SVDEF void
-sv_split_first(StringView  sv,
-               char        delim,
-               StringView *out_before_delim,
-               StringView *out_after_delim) SV_NOEXCEPT
+sv_map_free(SvMap *map) SV_NOEXCEPT
 {
-    const void *p = (sv.length ? memchr(sv.begin, (unsigned char)delim, sv.length) : NULL);
-    if (!p) {
-        if (out_before_delim) *out_before_delim = sv;
-        if (out_after_delim)  *out_after_delim  = sv_empty();
-        return;
-    }
-
-    size_t idx = (size_t)((const char *)p - sv.begin);
-    if (out_before_delim) *out_before_delim = sv_substr(sv, 0, idx);
-    if (out_after_delim)  *out_after_delim  = sv_substr(sv, idx+1, sv.length-idx-1);
+    if (!map) return;
+    sv_dealloc_(&map->allocator, map->ctrl, sv_align8_(map->capacity) + map->capacity * sizeof(SvMapSlot));
+    map->ctrl        = NULL;
+    map->slots       = NULL;
+    map->capacity    = 0;
+    map->count       = 0;
+    map->growth_left = 0;
 }
 
 SVDEF void
-sv_split_last(StringView  sv,
-              char        delim,
-              StringView *out_before_delim,
-              StringView *out_after_delim) SV_NOEXCEPT
+sv_map_clear(SvMap *map) SV_NOEXCEPT
 {
-    const void *p = (sv.length ? sv_memrchr_(sv.begin, (unsigned char)delim, sv.length) : NULL);
-    if (!p) {
-        if (out_before_delim) *out_before_delim = sv;
-        if (out_after_delim)  *out_after_delim  = sv_empty();
-        return;
-    }
+    SV_ASSERT(map != NULL);
 
-    size_t idx = (size_t)((const char *)p - sv.begin);
-    if (out_before_delim) *out_before_delim = sv_substr(sv, 0, idx);
-    if (out_after_delim)  *out_after_delim  = sv_substr(sv, idx+1, sv.length-idx-1);
+    if (map->capacity) memset(map->ctrl, (int)SV_MAP_EMPTY_, map->capacity);
+    map->count       = 0;
+    map->growth_left = sv_map_max_load_(map->capacity);
 }
 
-SVDEF void
-sv_split_once_from(StringView  sv,
-                   char        delim,
-                   size_t      pos,
-                   StringView *out_before_delim,
-                   StringView *out_after_delim) SV_NOEXCEPT
+SVDEF bool
+sv_map_reserve(SvMap *map, size_t count) SV_NOEXCEPT
 {
-    if (pos > sv.length) pos = sv.length;
+    SV_ASSERT(map != NULL);
 
-    const void *p = (sv.length ? memchr(sv.begin + pos, (unsigned char)delim, sv.length - pos) : NULL);
-    if (!p) {
-        if (out_before_delim) *out_before_delim = sv;
-        if (out_after_delim)  *out_after_delim  = sv_empty();
-        return;
-    }
+    if (count == 0 || count <= map->count + map->growth_left) return true;
+    if (count > SIZE_MAX / 2 - SIZE_MAX / 16) return false;
 
-    size_t idx = (size_t)((const char *)p - sv.begin);
-    if (out_before_delim) *out_before_delim = sv_substr(sv, 0, idx);
-    if (out_after_delim)  *out_after_delim  = sv_substr(sv, idx+1, sv.length-idx-1);
+    size_t capacity = map->capacity ? map->capacity : SV_MAP_GROUP_;
+    while (sv_map_max_load_(capacity) < count) capacity *= 2;
+    return sv_map_rehash_(map, capacity);
 }
 
-SVDEF size_t
-sv_to_cstr(StringView  sv,           // Adds null-terminator, you should
-           char       *buffer,       // allocate .length+1 to avoid truncation
-           size_t      buffer_size)  SV_NOEXCEPT
+// Insert key, known to be absent, with its precomputed hash.
+static inline bool
+sv_map_insert_new_(SvMap *map, StringView key, uint64_t hash, void *value)
 {
-    if (buffer_size == 0) {
-        return 0;
+    size_t i = map->capacity ? sv_map_free_slot_(map, hash) : SV_NPOS;
+    if (i == SV_NPOS || (map->ctrl[i] == SV_MAP_EMPTY_ && map->growth_left == 0)) {
+        // Out of empty slots: grow, or only drop tombstones if they are at least half the load
+        size_t capacity = map->capacity ? map->capacity : SV_MAP_GROUP_;
+        if (map->count >= sv_map_max_load_(capacity) / 2) {
+            if (capacity > SIZE_MAX / 2) return false;
+            capacity *= 2;
+        }
+        if (!sv_map_rehash_(map, capacity)) return false;
+        i = sv_map_free_slot_(map, hash);
     }
 
-    size_t n = sv.length;
-    if (n > buffer_size - 1) {
-        n = buffer_size - 1;
-    }
+    if (map->ctrl[i] == SV_MAP_EMPTY_) map->growth_left -= 1;
+    map->ctrl[i]        = (unsigned char)(hash & 0x7F);
+    map->slots[i].key   = key;
+    map->slots[i].hash  = hash;
+    map->slots[i].value = value;
+    map->count += 1;
+    return true;
+}
 
-    if (n > 0) {
-        memcpy(buffer, sv.begin, n);
-    }
-    buffer[n] = '\0';
+SVDEF bool
+sv_map_insert(SvMap *map, StringView key, void *value) SV_NOEXCEPT
+{
+    SV_ASSERT(map != NULL);
 
-    return n;
+    const uint64_t hash  = sv_hash64_seeded(key, map->seed);
+    const size_t   found = sv_map_lookup_(map, key, hash);
+    if (found != SV_NPOS) {
+        map->slots[found].value = value;
+        return true;
+    }
+    return sv_map_insert_new_(map, key, hash, value);
 }
 
-// Returns true on success, false on invalid/overflow.
-// Accepts optional leading '+' for u64.
-SVDEF bool
-sv_to_uint64(StringView sv, uint64_t *out) SV_NOEXCEPT
+SVDEF void **
+sv_map_find(const SvMap *map, StringView key) SV_NOEXCEPT
 {
-    if (!out || sv.length == 0) return false;
+    SV_ASSERT(map != NULL);
 
-    const char *p = sv.begin;
-    size_t      n = sv.length;
+    const size_t i = sv_map_lookup_(map, key, sv_hash64_seeded(key, map->seed));
+    return i == SV_NPOS ? NULL : &map->slots[i].value;
+}
 
-    // Optional '+'
-    if (*p == '+') { p++; if (--n == 0) return false; }
+SVDEF bool
+sv_map_contains(const SvMap *map, StringView key) SV_NOEXCEPT
+{
+    return sv_map_find(map, key) != NULL;
+}
 
-    uint64_t acc = 0;
-    bool     got_digit = false;
+SVDEF bool
+sv_map_remove(SvMap *map, StringView key) SV_NOEXCEPT
+{
+    SV_ASSERT(map != NULL);
 
-    while (n--) {
-        unsigned char c = (unsigned char)*p++;
-        if (c < '0' || c > '9') return false;
-        uint32_t d = (uint32_t)(c - '0');
+    const size_t i = sv_map_lookup_(map, key, sv_hash64_seeded(key, map->seed));
+    if (i == SV_NPOS) return false;
 
-        // acc*10 + d <= UINT64_MAX  =>  acc <= UINT64_MAX/10
-        if (acc > UINT64_MAX / 10ULL ||
-            (acc == UINT64_MAX / 10ULL && d > (UINT64_MAX % 10ULL))) {
-            return false; // overflow
-        }
-        acc = acc * 10ULL + (uint64_t)d;
-        got_digit = true;
+    // Lookups stop at a group with an empty slot, so if this group has one no
+    // probe sequence passes through it and the slot can become empty again.
+    const unsigned char *group = map->ctrl + (i & ~(size_t)(SV_MAP_GROUP_ - 1));
+    if (sv_map_match_(group, SV_MAP_EMPTY_)) {
+        map->ctrl[i]      = SV_MAP_EMPTY_;
+        map->growth_left += 1;
+    } else {
+        map->ctrl[i] = SV_MAP_DELETED_;
     }
-    if (!got_digit) return false;
-
-    *out = acc;
+    map->count -= 1;
     return true;
 }
 
-// Returns true on success, false on invalid/overflow.
-// Accepts leading '+' or '-'.
 SVDEF bool
-sv_to_int64(StringView sv, int64_t *out) SV_NOEXCEPT
+sv_map_next(const SvMap *map, size_t *cursor, StringView *out_key, void **out_value) SV_NOEXCEPT
 {
-    if (!out || sv.length == 0) return false;
-
-    const char *p = sv.begin;
-    size_t      n = sv.length;
-
-    bool neg = false;
-    if (*p == '+' || *p == '-') {
-        neg = (*p == '-');
-        p++; if (--n == 0) return false;
+    SV_ASSERT(map != NULL);
+    SV_ASSERT(cursor != NULL);
+
+    for (size_t i = *cursor; i < map->capacity; ++i) {
+        if (map->ctrl[i] & 0x80) continue;
+        if (out_key)   *out_key   = map->slots[i].key;
+        if (out_value) *out_value = map->slots[i].value;
+        *cursor = i + 1;
+        return true;
     }
+    *cursor = map->capacity;
+    return false;
+}
 
-    // We parse as unsigned then range-check against the signed limits.
-    uint64_t acc = 0;
-    const uint64_t pos_limit = (uint64_t)INT64_MAX;          //  9223372036854775807
-    const uint64_t neg_limit = (uint64_t)INT64_MAX + 1ULL;   //  9223372036854775808
-    const uint64_t limit     = neg ? neg_limit : pos_limit;
-
-    bool got_digit = false;
-    while (n--) {
-        unsigned char c = (unsigned char)*p++;
-        if (c < '0' || c > '9') return false;
-        uint32_t d = (uint32_t)(c - '0');
+#undef SV_MAP_GROUP_
+#undef SV_MAP_EMPTY_
+#undef SV_MAP_DELETED_
 
-        if (acc > limit / 10ULL ||
-            (acc == limit / 10ULL && (uint64_t)d > (limit % 10ULL))) {
-            return false; // overflow
-        }
-        acc       = acc * 10ULL + (uint64_t)d;
-        got_digit = true;
-    }
-    if (!got_digit) return false;
+// Arena blocks start with this header. Strings are never freed individually.
+typedef struct SvInternBlock_ {
+    struct SvInternBlock_ *next;
+    size_t                 size; // including the header
+} SvInternBlock_;
 
-    if (neg) {
-        if (acc == neg_limit) { *out = INT64_MIN; return true; }
-        *out = -(int64_t)acc;
-    } else {
-        *out = (int64_t)acc;
-    }
+// Add a block with at least size free bytes and make it the current one.
+static inline bool
+sv_intern_add_block_(SvInternPool *pool, size_t size)
+{
+    const size_t header = sv_align8_(sizeof(SvInternBlock_));
+    if (size > SIZE_MAX - header) return false;
+
+    SvInternBlock_ *block = (SvInternBlock_ *)sv_alloc_(&pool->allocator, header + size);
+    if (!block) return false;
+    block->next      = (SvInternBlock_ *)pool->blocks;
+    block->size      = header + size;
+    pool->blocks     = block;
+    pool->arena      = (char *)block + header;
+    pool->arena_left = size;
     return true;
 }
 
-SVDEF bool
-sv_to_long(StringView sv, long *out) SV_NOEXCEPT
+static inline bool
+sv_intern_reserve_views_(SvInternPool *pool, size_t count)
 {
-    if (!out) return false;
-#if LONG_MAX == 2147483647L  // 32-bit long
-    int64_t tmp;
-    if (!sv_to_int64(sv, &tmp)) return false;
-    if (tmp < LONG_MIN || tmp > LONG_MAX) return false;
-    *out = (long)tmp;
-    return true;
-#else                         // 64-bit long
-    int64_t tmp;
-    if (!sv_to_int64(sv, &tmp)) return false;
-    *out = (long)tmp;
+    if (count <= pool->views_capacity) return true;
+
+    size_t capacity = pool->views_capacity ? pool->views_capacity : 16;
+    while (capacity < count) capacity *= 2;
+    if (capacity > SIZE_MAX / sizeof(StringView)) return false;
+
+    StringView *views = (StringView *)sv_alloc_(&pool->allocator, capacity * sizeof(StringView));
+    if (!views) return false;
+    if (pool->count) memcpy(views, pool->views, pool->count * sizeof(StringView));
+    sv_dealloc_(&pool->allocator, pool->views, pool->views_capacity * sizeof(StringView));
+    pool->views          = views;
+    pool->views_capacity = capacity;
     return true;
-#endif
 }
 
 SVDEF bool
-sv_to_double(StringView sv, double *out) SV_NOEXCEPT
+sv_intern_pool_init(SvInternPool      *pool,
+                    size_t             strings,
+                    size_t             bytes,
+                    uint64_t           seed,
+                    const SvAllocator *allocator) SV_NOEXCEPT
 {
-    if (!out || sv.length == 0) return false;
+    SV_ASSERT(pool != NULL);
 
-    const char *p = sv.begin;
-    size_t      n = sv.length;
+    memset(pool, 0, sizeof *pool);
+    if (allocator) pool->allocator = *allocator;
+    if (!sv_map_init(&pool->index, strings, seed, allocator)) return false;
 
-    // Sign
-    bool neg = false;
-    if (*p == '+' || *p == '-') {
-        neg = (*p == '-');
-        p += 1;
-        if (--n == 0) return false;
-    }
+    const bool ok = sv_intern_reserve_views_(pool, strings) &&
+                    (bytes == 0 || (bytes <= SIZE_MAX - strings && sv_intern_add_block_(pool, bytes + strings)));
+    if (!ok) sv_intern_pool_free(pool);
+    return ok;
+}
 
-    // Integer part
-    unsigned long long int_part = 0;
-    bool               have_int = false;
-    while (n && *p >= '0' && *p <= '9') {
-        unsigned d = (unsigned)(*p - '0');
-        if (int_part <= 1844674407370955161ULL) { // floor(ULLONG_MAX/10)
-            int_part = int_part * 10ULL + (unsigned long long)d;
-        }
-        p += 1;
-        n -= 1;
-        have_int = true;
+SVDEF void
+sv_intern_pool_free(SvInternPool *pool) SV_NOEXCEPT
+{
+    if (!pool) return;
+
+    SvInternBlock_ *block = (SvInternBlock_ *)pool->blocks;
+    while (block) {
+        SvInternBlock_ *next = block->next;
+        sv_dealloc_(&pool->allocator, block, block->size);
+        block = next;
     }
+    sv_dealloc_(&pool->allocator, pool->views, pool->views_capacity * sizeof(StringView));
+    sv_map_free(&pool->index);
+    pool->views          = NULL;
+    pool->views_capacity = 0;
+    pool->count          = 0;
+    pool->blocks         = NULL;
+    pool->arena          = NULL;
+    pool->arena_left     = 0;
+}
 
-    // Fractional part
-    unsigned long long frac_acc    = 0; // exact up to 19 digits
-    int                frac_digits = 0;
-    bool               have_frac   = false;
+SVDEF bool
+sv_intern(SvInternPool *pool, StringView sv, uint32_t *out_id, StringView *out_view) SV_NOEXCEPT
+{
+    SV_ASSERT(pool != NULL);
 
-    // track tail contribution for digits beyond 19
-    double frac_tail = 0.0;
-    double tail_scale = 1e-20; // weight of the 20th fractional digit
+    const uint64_t hash  = sv_hash64_seeded(sv, pool->index.seed);
+    const size_t   found = sv_map_lookup_(&pool->index, sv, hash);
+    uint32_t       id;
 
-    if (n && *p == '.') {
-        p += 1;
-        n -= 1;
-        while (n && *p >= '0' && *p <= '9') {
-            unsigned d = (unsigned)(*p - '0');
-            if (frac_digits < 19) {
-                frac_acc = frac_acc * 10ULL + (unsigned long long)d;
-            } else {
-                // Add contribution of extra digits as we parse them
-                frac_tail  += (double)d * tail_scale;
-                tail_scale *= 0.1; // next digit is 10x smaller
-            }
-            frac_digits += 1;
-            p += 1;
-            n -= 1;
-            have_frac = true;
+    if (found != SV_NPOS) {
+        id = (uint32_t)(uintptr_t)pool->index.slots[found].value;
+    } else {
+        // Reserve everything first so a failure leaves the pool unchanged
+        if (pool->count >= UINT32_MAX || sv.length >= SIZE_MAX - SV_INTERN_BLOCK_SIZE) return false;
+        if (!sv_intern_reserve_views_(pool, pool->count + 1)) return false;
+        if (!sv_map_reserve(&pool->index, pool->count + 1)) return false;
+        if (sv.length + 1 > pool->arena_left) {
+            const size_t size = sv.length + 1 > SV_INTERN_BLOCK_SIZE / 2 ? sv.length + 1 : SV_INTERN_BLOCK_SIZE;
+            if (!sv_intern_add_block_(pool, size)) return false;
         }
-        if (!have_frac) return false; // '.' must be followed by at least one digit
+
+        char *copy = pool->arena;
+        if (sv.length) memcpy(copy, sv.begin, sv.length);
+        copy[sv.length]   = '\0';
+        pool->arena      += sv.length + 1;
+        pool->arena_left -= sv.length + 1;
+
+        id = (uint32_t)pool->count;
+        pool->views[id] = sv_from_parts(copy, sv.length);
+        pool->count += 1;
+        const bool inserted = sv_map_insert_new_(&pool->index, pool->views[id], hash, (void *)(uintptr_t)id);
+        SV_ASSERT(inserted); // cannot fail after sv_map_reserve()
+        (void)inserted;
     }
 
-    if (!have_int && !have_frac) return false;
+    if (out_id)   *out_id   = id;
+    if (out_view) *out_view = pool->views[id];
+    return true;
+}
 
-    // Exponent
-    bool have_exp = false;
-    bool exp_neg  = false;
-    int  exp_val  = 0;
-    if (n && (*p == 'e' || *p == 'E')) {
-        have_exp = true;
-        p += 1;
-        n -= 1;
-        if (!n) return false;
-        if (*p == '+' || *p == '-') {
-            exp_neg = (*p == '-');
-            p += 1;
-            if (--n == 0) return false;
-        }
-        bool got_exp = false;
-        while (n && *p >= '0' && *p <= '9') {
-            int d = (int)(*p - '0');
-            if (exp_val < 10000) exp_val = exp_val * 10 + d; // cap growth
-            p += 1;
-            n -= 1;
-            got_exp = true;
-        }
-        if (!got_exp) return false;
-    }
+SVDEF bool
+sv_intern_find(const SvInternPool *pool, StringView sv, uint32_t *out_id) SV_NOEXCEPT
+{
+    SV_ASSERT(pool != NULL);
 
-    // Must consume everything
-    if (n != 0) return false;
+    void **value = sv_map_find(&pool->index, sv);
+    if (!value) return false;
+    if (out_id) *out_id = (uint32_t)(uintptr_t)*value;
+    return true;
+}
 
-    // Build base value = int_part + frac_acc / 10^k (k up to 19)
-    static const double k_pow10[20] = {
-        1.0,
-        1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9,
-        1e10,1e11,1e12,1e13,1e14,1e15,1e16,1e17,1e18,1e19
-    };
+SVDEF StringView
+sv_intern_view(const SvInternPool *pool, uint32_t id) SV_NOEXCEPT
+{
+    SV_ASSERT(pool != NULL);
+    SV_ASSERT(id < pool->count);
+    return pool->views[id];
+}
 
-    double value      = (double)int_part;
-    if (frac_digits > 0) {
-        int    used = (frac_digits <= 19) ? frac_digits : 19;
-        double frac = (double)frac_acc / k_pow10[used];
-        value += frac + frac_tail;
-    }
+// floor(x * range / 2^64): maps a well-mixed 64-bit value onto [0, range)
+static inline size_t
+sv_fastrange_(uint64_t x, size_t range)
+{
+    uint64_t hi;
+    (void)sv_mul128_(x, (uint64_t)range, &hi);
+    return (size_t)hi;
+}
 
-    // Apply exponent via chunked scaling (no pow)
-    long exp_total = have_exp ? (exp_neg ? -exp_val : exp_val) : 0;
+static inline size_t
+sv_phf_slot_(uint64_t hash, uint64_t pilot, size_t slot_count)
+{
+    return sv_fastrange_((hash ^ (pilot * 0x9E3779B97F4A7C15ULL)) * 0xff51afd7ed558ccdULL, slot_count);
+}
 
-    if (value == 0.0) {
-        *out = neg ? -0.0 : 0.0;
-        return true;
+// Find a pilot for every bucket with the given seed, largest buckets first
+// while most slots are still free. Fills slot_of_key, or returns false.
+static inline bool
+sv_phf_search_(const StringView *keys,
+               size_t            n,
+               size_t            slot_count,
+               size_t            bucket_count,
+               uint64_t          seed,
+               uint16_t         *pilots,
+               uint64_t         *hashes,     // n
+               size_t           *by_bucket,  // n key indices, grouped by bucket
+               size_t           *starts,     // bucket_count + 1
+               size_t           *order,      // bucket_count bucket indices
+               size_t           *sizes,      // n + 2 counters
+               uint64_t         *taken,      // (slot_count + 63) / 64 bits
+               size_t           *slot_of_key)
+{
+    memset(starts, 0, (bucket_count + 1) * sizeof *starts);
+    for (size_t i = 0; i < n; ++i) {
+        hashes[i] = sv_hash64_seeded(keys[i], seed);
+        starts[sv_fastrange_(hashes[i], bucket_count) + 1] += 1;
     }
-
-    if (exp_total >  308)  return false; // overflow for double
-    if (exp_total < -400) {  // strong underflow
-        *out = neg ? -0.0 : 0.0;
-        return true;
+    for (size_t b = 0; b < bucket_count; ++b) starts[b + 1] += starts[b];
+    for (size_t i = 0; i < n; ++i) {
+        // starts[b] is used as a cursor and ends up at the start of bucket b + 1
+        by_bucket[starts[sv_fastrange_(hashes[i], bucket_count)]++] = i;
     }
+    for (size_t b = bucket_count; b > 0; --b) starts[b] = starts[b - 1];
+    starts[0] = 0;
+
+    // Counting sort of the buckets by descending size
+    memset(sizes, 0, (n + 2) * sizeof *sizes);
+    for (size_t b = 0; b < bucket_count; ++b) sizes[n - (starts[b + 1] - starts[b]) + 1] += 1;
+    for (size_t k = 0; k <= n; ++k) sizes[k + 1] += sizes[k];
+    for (size_t b = 0; b < bucket_count; ++b) order[sizes[n - (starts[b + 1] - starts[b])]++] = b;
+
+    memset(taken, 0, (slot_count + 63) / 64 * sizeof *taken);
+    for (size_t o = 0; o < bucket_count; ++o) {
+        const size_t b     = order[o];
+        const size_t first = starts[b], last = starts[b + 1];
+        if (first == last) break; // only empty buckets are left
+
+        uint64_t pilot = 0;
+        for (; pilot < 65536; ++pilot) {
+            size_t k = first;
+            for (; k < last; ++k) {
+                const size_t slot = sv_phf_slot_(hashes[by_bucket[k]], pilot, slot_count);
+                if (taken[slot / 64] >> (slot % 64) & 1) break;
+                taken[slot / 64] |= (uint64_t)1 << (slot % 64);
+                slot_of_key[by_bucket[k]] = slot;
+            }
+            if (k == last) break;
+            // Release the slots this pilot took before the collision
+            while (k-- > first) {
+                const size_t slot = slot_of_key[by_bucket[k]];
+                taken[slot / 64] &= ~((uint64_t)1 << (slot % 64));
+            }
+        }
+        if (pilot == 65536) return false;
+        pilots[b] = (uint16_t)pilot;
+    }
+    return true;
+}
 
-    static const double p10[9]     = { 1e1,  1e2,  1e4,   1e8,  1e16,  1e32,  1e64,  1e128,  1e256 };
-    static const double p10_inv[9] = { 1e-1, 1e-2, 1e-4,  1e-8, 1e-16, 1e-32, 1e-64, 1e-128, 1e-256 };
-    static const int    p10_exp[9] = { 1,    2,    4,     8,    16,    32,    64,    128,    256 };
-
-    #define SV_FINITE(x) (((x) - (x)) == 0.0)
-
-    double scaled = value;
-    long   e      = exp_total;
+SVDEF bool
+sv_phf_init(SvPhf *phf, const StringView *keys, size_t count, const SvAllocator *allocator) SV_NOEXCEPT
+{
+    SV_ASSERT(phf != NULL);
+    SV_ASSERT(keys != NULL || count == 0);
+
+    memset(phf, 0, sizeof *phf);
+    if (allocator) phf->allocator = *allocator;
+    if (count == 0) return true;
+    if (count > UINT32_MAX) return false;
+
+    // About 1% spare slots and 3 keys per bucket keep the pilots small
+    const size_t n            = count;
+    const size_t slot_count   = n + n / 100 + 1;
+    const size_t bucket_count = n / 3 + 1;
+
+    const size_t entries_sz = sv_align8_(n * sizeof(SvPhfEntry));
+    const size_t pilots_sz  = sv_align8_(bucket_count * sizeof(uint16_t));
+    const size_t remap_sz   = sv_align8_((slot_count - n) * sizeof(uint32_t));
+    unsigned char *mem = (unsigned char *)sv_alloc_(&phf->allocator, entries_sz + pilots_sz + remap_sz);
+    if (!mem) return false;
+
+    const size_t words    = (slot_count + 63) / 64;
+    const size_t temp_sz  = n * sizeof(uint64_t) + words * sizeof(uint64_t) +
+                            (n + (bucket_count + 1) + bucket_count + (n + 2) + n) * sizeof(size_t);
+    unsigned char *temp = (unsigned char *)sv_alloc_(&phf->allocator, temp_sz);
+    if (!temp) {
+        sv_dealloc_(&phf->allocator, mem, entries_sz + pilots_sz + remap_sz);
+        return false;
+    }
+    uint64_t *hashes      = (uint64_t *)(void *)temp;
+    uint64_t *taken       = hashes + n;
+    size_t   *by_bucket   = (size_t *)(void *)(taken + words);
+    size_t   *starts      = by_bucket + n;
+    size_t   *order       = starts + bucket_count + 1;
+    size_t   *sizes       = order + bucket_count;
+    size_t   *slot_of_key = sizes + n + 2;
+
+    SvPhfEntry *entries = (SvPhfEntry *)(void *)mem;
+    uint16_t   *pilots  = (uint16_t *)(void *)(mem + entries_sz);
+    uint32_t   *remap   = (uint32_t *)(void *)(mem + entries_sz + pilots_sz);
+
+    // Empty buckets keep pilot 0, which lookups of absent keys may read
+    memset(pilots, 0, pilots_sz);
+
+    // A few seeds before concluding the keys contain duplicates
+    bool found = false;
+    for (uint64_t attempt = 0; attempt < 4 && !found; ++attempt) {
+        phf->seed = attempt * 0x9E3779B97F4A7C15ULL;
+        found = sv_phf_search_(keys, n, slot_count, bucket_count, phf->seed, pilots,
+                               hashes, by_bucket, starts, order, sizes, taken, slot_of_key);
+    }
 
-    if (e > 0) {
-        for (int i = 8; i >= 0; --i) {
-            if (e >= p10_exp[i]) {
-                scaled *= p10[i];
-                if (!SV_FINITE(scaled)) return false; // overflow to inf/NaN
-                e -= p10_exp[i];
+    if (found) {
+        // Send keys in spare slots to the free positions below n, in order
+        size_t free_pos = 0;
+        for (size_t slot = n; slot < slot_count; ++slot) {
+            if (taken[slot / 64] >> (slot % 64) & 1) {
+                while (taken[free_pos / 64] >> (free_pos % 64) & 1) free_pos += 1;
+                remap[slot - n] = (uint32_t)free_pos++;
+            } else {
+                remap[slot - n] = 0;
             }
         }
-    } else if (e < 0) {
-        e = -e;
-        for (int i = 8; i >= 0; --i) {
-            if (e >= p10_exp[i]) {
-                scaled *= p10_inv[i]; // multiply by reciprocal to avoid division
-                e -= p10_exp[i];
-            }
+        for (size_t i = 0; i < n; ++i) {
+            const size_t slot = slot_of_key[i];
+            const size_t pos  = slot < n ? slot : remap[slot - n];
+            entries[pos].key   = keys[i];
+            entries[pos].index = i;
         }
     }
 
-    *out = neg ? -scaled : scaled;
+    sv_dealloc_(&phf->allocator, temp, temp_sz);
+    if (!found) {
+        sv_dealloc_(&phf->allocator, mem, entries_sz + pilots_sz + remap_sz);
+        memset(phf, 0, sizeof *phf);
+        return false;
+    }
+
+    phf->count        = n;
+    phf->slot_count   = slot_count;
+    phf->bucket_count = bucket_count;
+    phf->pilots       = pilots;
+    phf->remap        = remap;
+    phf->entries      = entries;
+    phf->memory       = mem;
+    phf->memory_size  = entries_sz + pilots_sz + remap_sz;
     return true;
+}
 
-    #undef SV_FINITE
+SVDEF void
+sv_phf_free(SvPhf *phf) SV_NOEXCEPT
+{
+    if (!phf) return;
+    sv_dealloc_(&phf->allocator, phf->memory, phf->memory_size);
+    phf->memory  = NULL;
+    phf->entries = NULL;
+    phf->pilots  = NULL;
+    phf->remap   = NULL;
+    phf->count   = 0;
 }
 
-// FNV-1a: http://www.isthe.com/chongo/tech/comp/fnv/
-SVDEF uint64_t
-sv_hash(StringView sv) SV_NOEXCEPT
+SVDEF size_t
+sv_phf_lookup(const SvPhf *phf, StringView sv) SV_NOEXCEPT
 {
-    uint64_t hash = 1469598103934665603ULL; // offset basis
-    for (size_t i = 0; i < sv.length; ++i) {
-        hash ^= (unsigned char)sv.begin[i];
-        hash *= 1099511628211ULL; // FNV prime
-    }
-    return hash;
+    SV_ASSERT(phf != NULL);
+    if (phf->count == 0) return SV_NPOS;
+
+    const uint64_t hash  = sv_hash64_seeded(sv, phf->seed);
+    const uint16_t pilot = phf->pilots[sv_fastrange_(hash, phf->bucket_count)];
+    size_t         pos   = sv_phf_slot_(hash, pilot, phf->slot_count);
+    if (pos >= phf->count) pos = phf->remap[pos - phf->count];
+
+    const SvPhfEntry *entry = &phf->entries[pos];
+    return sv_eq(entry->key, sv) ? entry->index : SV_NPOS;
 }
 
 #if SV_HAS_PRINT
@@ -5,8 +5,10 @@
 
 #include "minitest.h"
 
+#include <ctype.h>
 #include <inttypes.h>
 #include <math.h>
+#include <stdlib.h>
 
 MT_DEFINE_TEST(empty)
 {
@@ -605,6 +607,472 @@ MT_DEFINE_TEST(rfind_substr_from)
     }
 }
 
+static size_t
+naive_find_substr_from(StringView hay, size_t pos, StringView needle)
+{
+    if (pos > hay.length) pos = hay.length;
+    for (size_t i = pos; i + needle.length <= hay.length; ++i) {
+        if (memcmp(hay.begin + i, needle.begin, needle.length) == 0) return i;
+    }
+    return SV_NPOS;
+}
+
+MT_DEFINE_TEST(find_substr_long_haystack)
+{
+    // The first and last needle bytes occur all over the haystack, so every
+    // block of the vectorized search has candidate lanes to verify.
+    char buf[300];
+    for (size_t i = 0; i < sizeof buf; ++i) buf[i] = (i % 3 == 0) ? ' ' : (i % 3 == 1) ? '/' : 'a';
+    StringView hay = sv_from_parts(buf, sizeof buf);
+
+    {
+        StringView needle = SV_LIT(" /a /a /b");
+        MT_CHECK_THAT(sv_find_substr(hay, needle) == SV_NPOS);
+        MT_CHECK_THAT(sv_contains(hay, needle) == false);
+    }
+
+    const char *needles[] = { " /", " /a", " /a /x", " /a /a /a /a /a /a /a /a /a /a /a /a /a /a /a /a /a /a /a /a /a /a /a /a /a /x" };
+    for (size_t k = 0; k < sizeof needles / sizeof needles[0]; ++k) {
+        StringView needle = sv_from_cstr(needles[k]);
+        for (size_t at = 0; at + needle.length <= sizeof buf; at += 7) {
+            char saved[128];
+            memcpy(saved, buf + at, needle.length);
+            memcpy(buf + at, needle.begin, needle.length);
+
+            bool ok = true;
+            for (size_t pos = 0; pos <= sizeof buf + 1; pos += 5) {
+                ok = ok && sv_find_substr_from(hay, pos, needle) == naive_find_substr_from(hay, pos, needle);
+            }
+            MT_CHECK_THAT(ok);
+            MT_CHECK_THAT(sv_find_substr(hay, needle) == naive_find_substr_from(hay, 0, needle));
+
+            memcpy(buf + at, saved, needle.length);
+        }
+    }
+    {
+        // Match flush against the end of the haystack
+        memcpy(buf + sizeof buf - 3, "xyz", 3);
+        MT_CHECK_THAT(sv_find_substr(hay, SV_LIT("xyz")) == sizeof buf - 3);
+        MT_CHECK_THAT(sv_find_substr(hay, SV_LIT("axyz")) == sizeof buf - 4);
+        MT_CHECK_THAT(sv_find_substr_from(hay, sizeof buf - 3, SV_LIT("xyz")) == sizeof buf - 3);
+        MT_CHECK_THAT(sv_find_substr_from(hay, sizeof buf - 2, SV_LIT("xyz")) == SV_NPOS);
+    }
+}
+
+static size_t
+naive_rfind_substr_from(StringView hay, size_t pos, StringView needle)
+{
+    if (needle.length > hay.length) return SV_NPOS;
+    size_t i = hay.length - needle.length;
+    if (i > pos) i = pos;
+    for (;; --i) {
+        if (memcmp(hay.begin + i, needle.begin, needle.length) == 0) return i;
+        if (i == 0) return SV_NPOS;
+    }
+}
+
+MT_DEFINE_TEST(rfind_long_haystack)
+{
+    char buf[300];
+    for (size_t i = 0; i < sizeof buf; ++i) buf[i] = (i % 3 == 0) ? ' ' : (i % 3 == 1) ? '/' : 'a';
+    StringView hay = sv_from_parts(buf, sizeof buf);
+
+    // Single byte: every position, both through rfind_char and rfind_char_from
+    for (size_t at = 0; at < sizeof buf; ++at) {
+        const char saved = buf[at];
+        buf[at] = 'x';
+        MT_CHECK_THAT(sv_rfind_char(hay, 'x') == at);
+        MT_CHECK_THAT(sv_rfind_char_from(hay, at, 'x') == at);
+        MT_CHECK_THAT(at == 0 || sv_rfind_char_from(hay, at - 1, 'x') == SV_NPOS);
+        MT_CHECK_THAT(sv_rfind_char_from(hay, sizeof buf + 10, 'x') == at);
+        buf[at] = saved;
+    }
+    MT_CHECK_THAT(sv_rfind_char(hay, 'x') == SV_NPOS);
+    MT_CHECK_THAT(sv_rfind_char(hay, ' ') == 297);
+
+    const char *needles[] = { " /", " /a", " /a /x", " /a /a /a /a /a /a /a /a /a /a /a /a /a /a /a /a /a /a /a /a /a /a /a /a /a /x" };
+    for (size_t k = 0; k < sizeof needles / sizeof needles[0]; ++k) {
+        StringView needle = sv_from_cstr(needles[k]);
+        for (size_t at = 0; at + needle.length <= sizeof buf; at += 7) {
+            char saved[128];
+            memcpy(saved, buf + at, needle.length);
+            memcpy(buf + at, needle.begin, needle.length);
+
+            bool ok = true;
+            for (size_t pos = needle.length - 1; pos <= sizeof buf + 1; pos += 5) {
+                ok = ok && sv_rfind_substr_from(hay, pos, needle) == naive_rfind_substr_from(hay, pos, needle);
+            }
+            MT_CHECK_THAT(ok);
+            MT_CHECK_THAT(sv_rfind_substr(hay, needle) == naive_rfind_substr_from(hay, SV_NPOS, needle));
+
+            memcpy(buf + at, saved, needle.length);
+        }
+    }
+    {
+        memcpy(buf, "xyz", 3);
+        MT_CHECK_THAT(sv_rfind_substr(hay, SV_LIT("xyz")) == 0);
+        MT_CHECK_THAT(sv_rfind_substr(hay, SV_LIT("xyz ")) == 0);
+        MT_CHECK_THAT(sv_rfind_substr(hay, SV_LIT("xyz/")) == SV_NPOS);
+    }
+    {
+        StringView before, after;
+        sv_split_last(hay, 'z', &before, &after);
+        MT_CHECK_THAT(before.length == 2);
+        MT_CHECK_THAT(after.length == sizeof buf - 3);
+    }
+}
+
+MT_DEFINE_TEST(searcher_basic)
+{
+    {
+        SvSearcher s;
+        sv_searcher_init(&s, SV_LIT(""));
+        MT_CHECK_THAT(sv_searcher_find(&s, SV_LIT("abc")) == 0);
+        MT_CHECK_THAT(sv_searcher_find_from(&s, SV_LIT("abc"), 2) == 2);
+        MT_CHECK_THAT(sv_searcher_find_from(&s, SV_LIT("abc"), 9) == 3);
+        MT_CHECK_THAT(sv_searcher_rfind(&s, SV_LIT("abc")) == 3);
+        MT_CHECK_THAT(sv_searcher_rfind_from(&s, SV_LIT("abc"), 1) == 1);
+    }
+    {
+        SvSearcher s;
+        sv_searcher_init(&s, SV_LIT("\r\n\r\n"));
+        StringView hay = SV_LIT("GET / HTTP/1.1\r\nHost: x\r\n\r\nbody\r\n\r\n");
+        MT_CHECK_THAT(sv_searcher_find(&s, hay) == 23);
+        MT_CHECK_THAT(sv_searcher_find_from(&s, hay, 24) == 31);
+        MT_CHECK_THAT(sv_searcher_rfind(&s, hay) == 31);
+        MT_CHECK_THAT(sv_searcher_rfind_from(&s, hay, 30) == 23);
+        MT_CHECK_THAT(sv_searcher_find(&s, SV_LIT("\r\n\r")) == SV_NPOS);
+        MT_CHECK_THAT(sv_searcher_find(&s, sv_empty()) == SV_NPOS);
+        MT_CHECK_THAT(sv_searcher_rfind(&s, sv_empty()) == SV_NPOS);
+    }
+    {
+        SvSearcher s;
+        sv_searcher_init(&s, SV_LIT("o"));
+        MT_CHECK_THAT(sv_searcher_find(&s, SV_LIT("Hello world")) == 4);
+        MT_CHECK_THAT(sv_searcher_rfind(&s, SV_LIT("Hello world")) == 7);
+        MT_CHECK_THAT(sv_searcher_rfind_from(&s, SV_LIT("Hello world"), 6) == 4);
+    }
+}
+
+MT_DEFINE_TEST(searcher_matches_find_substr)
+{
+    // Small alphabet haystack so long needles produce many partial matches
+    char buf[512];
+    uint32_t state = 12345u;
+    for (size_t i = 0; i < sizeof buf; ++i) {
+        state = state * 1103515245u + 12345u;
+        buf[i] = (char)('a' + ((state >> 16) % 3));
+    }
+    StringView hay = sv_from_parts(buf, sizeof buf);
+
+    const char *periodic[] = {
+        "abababababababababababababababababababab",
+        "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab",
+        "baaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
+        "abcabcabcabcabcabcabcabcabcabcabcabcabcabcabca",
+    };
+
+    bool ok = true;
+    for (size_t len = 1; len <= 80; len += (len < 40 ? 1 : 9)) {
+        for (size_t at = 0; at + len <= sizeof buf; at += 61) {
+            SvSearcher s;
+            StringView needle = sv_from_parts(buf + at, len);
+            sv_searcher_init(&s, needle);
+            for (size_t pos = 0; pos <= sizeof buf + 1; pos += 13) {
+                ok = ok && sv_searcher_find_from(&s, hay, pos) == sv_find_substr_from(hay, pos, needle);
+                ok = ok && sv_searcher_rfind_from(&s, hay, pos) == sv_rfind_substr_from(hay, pos, needle);
+            }
+            ok = ok && sv_searcher_find(&s, hay) == sv_find_substr(hay, needle);
+            ok = ok && sv_searcher_rfind(&s, hay) == sv_rfind_substr(hay, needle);
+        }
+    }
+    MT_CHECK_THAT(ok);
+
+    // Periodic needles planted into a haystack made of their own period
+    for (size_t k = 0; k < sizeof periodic / sizeof periodic[0]; ++k) {
+        StringView needle = sv_from_cstr(periodic[k]);
+        SvSearcher s;
+        sv_searcher_init(&s, needle);
+        for (size_t i = 0; i < sizeof buf; ++i) buf[i] = needle.begin[i % 2];
+        for (size_t at = 0; at + needle.length <= sizeof buf; at += 37) {
+            memcpy(buf + at, needle.begin, needle.length);
+            bool found_ok = true;
+            for (size_t pos = 0; pos <= sizeof buf; pos += 11) {
+                found_ok = found_ok && sv_searcher_find_from(&s, hay, pos) == naive_find_substr_from(hay, pos, needle);
+                found_ok = found_ok && sv_searcher_rfind_from(&s, hay, pos) == sv_rfind_substr_from(hay, pos, needle);
+            }
+            MT_CHECK_THAT(found_ok);
+        }
+    }
+}
+
+static size_t
+naive_multi_find_from(const StringView *patterns, size_t count, StringView hay, size_t pos, size_t *out_pattern)
+{
+    if (pos > hay.length) pos = hay.length;
+    for (size_t i = pos; i <= hay.length; ++i) {
+        for (size_t k = 0; k < count; ++k) {
+            if (patterns[k].length <= hay.length - i &&
+                memcmp(hay.begin + i, patterns[k].begin, patterns[k].length) == 0) {
+                *out_pattern = k;
+                return i;
+            }
+        }
+    }
+    return SV_NPOS;
+}
+
+typedef struct {
+    size_t live_bytes;
+    size_t allocations;
+} CountingAllocator;
+
+static void *
+counting_alloc(void *ctx, size_t size)
+{
+    CountingAllocator *a = (CountingAllocator *)ctx;
+    a->live_bytes  += size;
+    a->allocations += 1;
+    return malloc(size);
+}
+
+static void
+counting_free(void *ctx, void *ptr, size_t size)
+{
+    CountingAllocator *a = (CountingAllocator *)ctx;
+    a->live_bytes -= size;
+    free(ptr);
+}
+
+// An SvAllocator that tracks live bytes and allocation count in *counter
+static SvAllocator
+counting_allocator(CountingAllocator *counter)
+{
+    SvAllocator allocator;
+    allocator.alloc = counting_alloc;
+    allocator.free  = counting_free;
+    allocator.ctx   = counter;
+    return allocator;
+}
+
+MT_DEFINE_TEST(multi_searcher_basic)
+{
+    const StringView patterns[] = { SV_LIT("password="), SV_LIT("token"), SV_LIT("pass"), SV_LIT("secret") };
+    SvMultiSearcher ms;
+    MT_ASSERT_THAT(sv_multi_searcher_init(&ms, patterns, 4, NULL));
+
+    size_t idx = SV_NPOS;
+    StringView line = SV_LIT("user=bob password=hunter2 token=abc");
+    MT_CHECK_THAT(sv_multi_searcher_find(&ms, line, &idx) == 9 && idx == 0);
+    MT_CHECK_THAT(sv_multi_searcher_find_from(&ms, line, 10, &idx) == 26 && idx == 1);
+    MT_CHECK_THAT(sv_multi_searcher_find(&ms, SV_LIT("passport"), &idx) == 0 && idx == 2);
+    MT_CHECK_THAT(sv_multi_searcher_find(&ms, SV_LIT("nothing here"), &idx) == SV_NPOS);
+    MT_CHECK_THAT(sv_multi_searcher_find(&ms, sv_empty(), NULL) == SV_NPOS);
+    MT_CHECK_THAT(sv_multi_searcher_find_from(&ms, line, 100, NULL) == SV_NPOS);
+    sv_multi_searcher_free(&ms);
+
+    // Empty pattern matches at pos unless a lower-indexed pattern matches there too
+    const StringView with_empty[] = { SV_LIT("ab"), SV_LIT(""), SV_LIT("b") };
+    MT_ASSERT_THAT(sv_multi_searcher_init(&ms, with_empty, 3, NULL));
+    MT_CHECK_THAT(sv_multi_searcher_find(&ms, SV_LIT("xab"), &idx) == 0 && idx == 1);
+    MT_CHECK_THAT(sv_multi_searcher_find_from(&ms, SV_LIT("xab"), 1, &idx) == 1 && idx == 0);
+    MT_CHECK_THAT(sv_multi_searcher_find_from(&ms, SV_LIT("xab"), 9, &idx) == 3 && idx == 1);
+    sv_multi_searcher_free(&ms);
+
+    MT_ASSERT_THAT(sv_multi_searcher_init(&ms, NULL, 0, NULL));
+    MT_CHECK_THAT(sv_multi_searcher_find(&ms, line, &idx) == SV_NPOS);
+    sv_multi_searcher_free(&ms);
+}
+
+MT_DEFINE_TEST(multi_searcher_matches_naive)
+{
+    char hay_buf[700];
+    char pat_buf[400 * 6];
+    StringView patterns[400];
+    uint32_t state = 99u;
+    for (size_t i = 0; i < sizeof hay_buf; ++i) {
+        state = state * 1103515245u + 12345u;
+        hay_buf[i] = (char)('a' + ((state >> 16) % 5));
+    }
+    for (size_t i = 0; i < 400; ++i) {
+        state = state * 1103515245u + 12345u;
+        const size_t len = 1 + ((state >> 16) % 6);
+        for (size_t k = 0; k < len; ++k) {
+            state = state * 1103515245u + 12345u;
+            pat_buf[i * 6 + k] = (char)('a' + ((state >> 16) % 5));
+        }
+        patterns[i] = sv_from_parts(pat_buf + i * 6, len);
+    }
+    StringView hay = sv_from_parts(hay_buf, sizeof hay_buf);
+
+    // Different set sizes exercise both the Teddy and Aho-Corasick paths.
+    // Skipping patterns keeps the shortest ones from always matching first.
+    const size_t sizes[] = { 1, 2, 5, 8, 9, 32, 33, 120, 400 };
+    for (size_t s = 0; s < sizeof sizes / sizeof sizes[0]; ++s) {
+        const size_t count = sizes[s];
+        for (size_t first = 0; first + count <= 400; first += (count < 50 ? 37 : 400)) {
+            SvMultiSearcher ms;
+            MT_ASSERT_THAT(sv_multi_searcher_init(&ms, patterns + first, count, NULL));
+            bool ok = true;
+            for (size_t pos = 0; pos <= sizeof hay_buf; pos += 7) {
+                size_t idx = SV_NPOS, expected_idx = SV_NPOS;
+                const size_t got      = sv_multi_searcher_find_from(&ms, hay, pos, &idx);
+                const size_t expected = naive_multi_find_from(patterns + first, count, hay, pos, &expected_idx);
+                ok = ok && got == expected && (got == SV_NPOS || idx == expected_idx);
+            }
+            MT_CHECK_THAT(ok);
+            sv_multi_searcher_free(&ms);
+        }
+    }
+
+    // Long, rarely matching patterns
+    const StringView rare[] = { SV_LIT("eeeeeeeee"), SV_LIT("abcdeabcde"), SV_LIT("zz"), SV_LIT("ddddcccc") };
+    SvMultiSearcher ms;
+    MT_ASSERT_THAT(sv_multi_searcher_init(&ms, rare, 4, NULL));
+    size_t idx = SV_NPOS, expected_idx = SV_NPOS;
+    MT_CHECK_THAT(sv_multi_searcher_find(&ms, hay, &idx) == naive_multi_find_from(rare, 4, hay, 0, &expected_idx));
+    memcpy(hay_buf + 650, "ddddcccc", 8);
+    MT_CHECK_THAT(sv_multi_searcher_find(&ms, hay, &idx) == naive_multi_find_from(rare, 4, hay, 0, &expected_idx));
+    MT_CHECK_THAT(idx == expected_idx);
+    sv_multi_searcher_free(&ms);
+}
+
+MT_DEFINE_TEST(multi_searcher_allocator)
+{
+    CountingAllocator counter   = { 0, 0 };
+    SvAllocator       allocator = counting_allocator(&counter);
+
+    StringView patterns[100];
+    char buf[100][4];
+    for (size_t i = 0; i < 100; ++i) {
+        buf[i][0] = 'k';
+        buf[i][1] = (char)('0' + i / 10);
+        buf[i][2] = (char)('0' + i % 10);
+        patterns[i] = sv_from_parts(buf[i], 3);
+    }
+
+    SvMultiSearcher ms;
+    MT_ASSERT_THAT(sv_multi_searcher_init(&ms, patterns, 100, &allocator));
+    MT_CHECK_THAT(counter.allocations == 1);
+    MT_CHECK_THAT(counter.live_bytes > 0);
+
+    size_t idx = SV_NPOS;
+    MT_CHECK_THAT(sv_multi_searcher_find(&ms, SV_LIT("k1 k9 k42 k07"), &idx) == 6 && idx == 42);
+    MT_CHECK_THAT(counter.allocations == 1);
+
+    sv_multi_searcher_free(&ms);
+    MT_CHECK_THAT(counter.live_bytes == 0);
+}
+
+MT_DEFINE_TEST(byteset_basic)
+{
+    SvByteSet ws;
+    sv_byteset_init(&ws, SV_LIT(" \t\r\n"));
+    MT_CHECK_THAT(sv_byteset_contains(&ws, ' '));
+    MT_CHECK_THAT(sv_byteset_contains(&ws, '\n'));
+    MT_CHECK_THAT(!sv_byteset_contains(&ws, 'a'));
+    MT_CHECK_THAT(!sv_byteset_contains(&ws, '\0'));
+
+    StringView sv = SV_LIT("  key = \"value\"\t\n");
+    MT_CHECK_THAT(sv_find_first_of(sv, &ws) == 0);
+    MT_CHECK_THAT(sv_find_first_not_of(sv, &ws) == 2);
+    MT_CHECK_THAT(sv_find_last_of(sv, &ws) == 16);
+    MT_CHECK_THAT(sv_find_last_not_of(sv, &ws) == 14);
+    MT_CHECK_THAT(sv_find_first_of_from(sv, 2, &ws) == 5);
+    MT_CHECK_THAT(sv_find_first_of_from(sv, 17, &ws) == SV_NPOS);
+    MT_CHECK_THAT(sv_find_first_of_from(sv, 99, &ws) == SV_NPOS);
+    MT_CHECK_THAT(sv_find_last_of_from(sv, 14, &ws) == 7);
+    MT_CHECK_THAT(sv_find_last_of_from(sv, 99, &ws) == 16);
+    MT_CHECK_THAT(sv_find_last_not_of_from(sv, 1, &ws) == SV_NPOS);
+
+    MT_CHECK_THAT(sv_find_first_of(sv_empty(), &ws) == SV_NPOS);
+    MT_CHECK_THAT(sv_find_first_not_of(sv_empty(), &ws) == SV_NPOS);
+    MT_CHECK_THAT(sv_find_last_of(sv_empty(), &ws) == SV_NPOS);
+    MT_CHECK_THAT(sv_find_last_not_of(sv_empty(), &ws) == SV_NPOS);
+
+    SvByteSet none;
+    sv_byteset_init(&none, sv_empty());
+    MT_CHECK_THAT(sv_find_first_of(sv, &none) == SV_NPOS);
+    MT_CHECK_THAT(sv_find_first_not_of(sv, &none) == 0);
+}
+
+MT_DEFINE_TEST(byteset_all_byte_values)
+{
+    // Every byte value, in and out of the set, at every lane of a long buffer
+    unsigned char buf[200];
+    for (unsigned v = 0; v < 256; v += 1) {
+        SvByteSet set;
+        sv_byteset_init(&set, sv_empty());
+        sv_byteset_add(&set, (char)v);
+        sv_byteset_add(&set, (char)(v ^ 0x80));
+
+        SvByteSet others;
+        sv_byteset_init(&others, sv_empty());
+        for (unsigned o = 0; o < 256; ++o) {
+            if (o != v && o != (v ^ 0x80)) sv_byteset_add(&others, (char)o);
+        }
+
+        const unsigned char filler = (unsigned char)((v + 1) ^ 0x40);
+        memset(buf, filler, sizeof buf);
+        StringView sv = sv_from_parts((const char *)buf, sizeof buf);
+        MT_CHECK_THAT(sv_find_first_of(sv, &set) == SV_NPOS);
+        MT_CHECK_THAT(sv_find_last_of(sv, &set) == SV_NPOS);
+
+        bool ok = true;
+        for (size_t at = 0; at < sizeof buf; at += 3) {
+            buf[at] = (unsigned char)v;
+            ok = ok && sv_find_first_of(sv, &set) == at;
+            ok = ok && sv_find_last_of(sv, &set) == at;
+            ok = ok && sv_find_first_not_of(sv, &others) == at;
+            ok = ok && sv_find_last_not_of(sv, &others) == at;
+            ok = ok && sv_find_first_of_from(sv, at + 1, &set) == SV_NPOS;
+            ok = ok && (at == 0 || sv_find_last_of_from(sv, at - 1, &set) == SV_NPOS);
+            buf[at] = filler;
+        }
+        MT_CHECK_THAT(ok);
+    }
+}
+
+MT_DEFINE_TEST(find_char2_char3)
+{
+    StringView sv = SV_LIT("a,b\"c\nd,e");
+    MT_CHECK_THAT(sv_find_char2(sv, '"', ',') == 1);
+    MT_CHECK_THAT(sv_find_char3(sv, '\n', '"', 'x') == 3);
+    MT_CHECK_THAT(sv_rfind_char2(sv, '"', '\n') == 5);
+    MT_CHECK_THAT(sv_rfind_char3(sv, ',', '"', '\n') == 7);
+    MT_CHECK_THAT(sv_find_char2_from(sv, 2, ',', '\n') == 5);
+    MT_CHECK_THAT(sv_find_char3_from(sv, 8, ',', '"', '\n') == SV_NPOS);
+    MT_CHECK_THAT(sv_find_char3_from(sv, 99, ',', '"', '\n') == SV_NPOS);
+    MT_CHECK_THAT(sv_rfind_char2_from(sv, 4, ',', '"') == 3);
+    MT_CHECK_THAT(sv_rfind_char3_from(sv, 0, ',', '"', '\n') == SV_NPOS);
+    MT_CHECK_THAT(sv_rfind_char3_from(sv, 99, 'a', 'b', 'e') == 8);
+    MT_CHECK_THAT(sv_find_char2(sv_empty(), 'a', 'b') == SV_NPOS);
+    MT_CHECK_THAT(sv_rfind_char3(sv_empty(), 'a', 'b', 'c') == SV_NPOS);
+
+    // Long buffer: each needle byte at every position, first and last occurrence
+    char buf[150];
+    memset(buf, '.', sizeof buf);
+    StringView hay = sv_from_parts(buf, sizeof buf);
+    MT_CHECK_THAT(sv_find_char3(hay, ',', '"', '\n') == SV_NPOS);
+    MT_CHECK_THAT(sv_rfind_char3(hay, ',', '"', '\n') == SV_NPOS);
+
+    const char needles[] = { ',', '"', '\n' };
+    bool ok = true;
+    for (size_t k = 0; k < 3; ++k) {
+        for (size_t at = 0; at < sizeof buf; ++at) {
+            buf[at] = needles[k];
+            ok = ok && sv_find_char3(hay, ',', '"', '\n') == at;
+            ok = ok && sv_rfind_char3(hay, ',', '"', '\n') == at;
+            ok = ok && sv_find_char2(hay, needles[k], 'x') == at;
+            ok = ok && sv_rfind_char2(hay, 'x', needles[k]) == at;
+            ok = ok && sv_find_char3_from(hay, at + 1, ',', '"', '\n') == SV_NPOS;
+            ok = ok && (at == 0 || sv_rfind_char3_from(hay, at - 1, ',', '"', '\n') == SV_NPOS);
+            buf[at] = '.';
+        }
+    }
+    MT_CHECK_THAT(ok);
+}
+
 MT_DEFINE_TEST(find_substr_cstr)
 {
     {
@@ -788,6 +1256,59 @@ MT_DEFINE_TEST(trim)
     }
 }
 
+MT_DEFINE_TEST(trim_ascii)
+{
+    MT_CHECK_THAT(sv_eq_cstr(sv_trim_ascii(SV_LIT(" \t\r\n\v\ffoo bar\f\v\n\r\t ")), "foo bar"));
+    MT_CHECK_THAT(sv_trim_ascii(SV_LIT(" \t\n ")).length == 0);
+    MT_CHECK_THAT(sv_trim_ascii(sv_empty()).length == 0);
+    MT_CHECK_THAT(sv_eq_cstr(sv_trim_left_ascii(SV_LIT("  x  ")), "x  "));
+    MT_CHECK_THAT(sv_eq_cstr(sv_trim_right_ascii(SV_LIT("  x  ")), "  x"));
+    MT_CHECK_THAT(sv_eq_cstr(sv_trim_ascii(SV_LIT("\xA0x\x08")), "\xA0x\x08"));
+
+    // Padded fields of every length around the vector widths, against an
+    // isspace() trim (the test never calls setlocale, so this is the "C" locale)
+    char buf[100];
+    bool ok = true;
+    for (size_t pad_left = 0; pad_left < 40; ++pad_left) {
+        for (size_t pad_right = 0; pad_right < 40; ++pad_right) {
+            size_t n = 0;
+            for (size_t i = 0; i < pad_left; ++i)  buf[n++] = " \t\n\v\f\r"[i % 6];
+            buf[n++] = 'v';
+            buf[n++] = (pad_left & 1) ? ' ' : '\x85';
+            buf[n++] = 'w';
+            for (size_t i = 0; i < pad_right; ++i) buf[n++] = " \r\f\v\n\t"[i % 6];
+
+            size_t lo = 0, hi = n;
+            while (lo < hi && isspace((unsigned char)buf[lo]))     ++lo;
+            while (hi > lo && isspace((unsigned char)buf[hi - 1])) --hi;
+
+            const StringView sv = sv_from_parts(buf, n);
+            const StringView t  = sv_trim_ascii(sv);
+            ok = ok && t.begin == buf + lo && t.length == hi - lo;
+            ok = ok && t.begin == buf + pad_left && t.length == 3;
+            ok = ok && sv_trim_left_ascii(sv).length == n - pad_left;
+            ok = ok && sv_trim_right_ascii(sv).length == n - pad_right;
+
+            const StringView all = sv_from_parts(buf, pad_left);
+            ok = ok && sv_trim_left_ascii(all).length == 0 && sv_trim_right_ascii(all).length == 0;
+        }
+    }
+    MT_CHECK_THAT(ok);
+}
+
+MT_DEFINE_TEST(trim_set)
+{
+    SvByteSet zeros;
+    sv_byteset_init(&zeros, SV_LIT("0_"));
+
+    MT_CHECK_THAT(sv_eq_cstr(sv_trim_set(SV_LIT("00_1200_"), &zeros), "12"));
+    MT_CHECK_THAT(sv_eq_cstr(sv_trim_left_set(SV_LIT("00_1200_"), &zeros), "1200_"));
+    MT_CHECK_THAT(sv_eq_cstr(sv_trim_right_set(SV_LIT("00_1200_"), &zeros), "00_12"));
+    MT_CHECK_THAT(sv_trim_set(SV_LIT("0_0_0"), &zeros).length == 0);
+    MT_CHECK_THAT(sv_trim_set(sv_empty(), &zeros).length == 0);
+    MT_CHECK_THAT(sv_eq_cstr(sv_trim_set(SV_LIT(" 7 "), &zeros), " 7 "));
+}
+
 MT_DEFINE_TEST(take_basic)
 {
     StringView sv = sv_from_cstr("abcde");
@@ -1331,6 +1852,328 @@ MT_DEFINE_TEST(split_once_from)
     }
 }
 
+MT_DEFINE_TEST(split_first_of)
+{
+    SvByteSet delims;
+    sv_byteset_init(&delims, SV_LIT(",;\n"));
+    {
+        StringView before = sv_empty(), after = sv_empty();
+        sv_split_first_of(SV_LIT("key;value,rest"), &delims, &before, &after);
+        MT_CHECK_THAT(sv_eq_cstr(before, "key"));
+        MT_CHECK_THAT(sv_eq_cstr(after, "value,rest"));
+    }
+    {
+        StringView before = sv_empty(), after = sv_empty();
+        sv_split_first_of(SV_LIT("no delimiter"), &delims, &before, &after);
+        MT_CHECK_THAT(sv_eq_cstr(before, "no delimiter"));
+        MT_CHECK_THAT(after.length == 0);
+    }
+    {
+        StringView before = sv_empty(), after = sv_empty();
+        sv_split_first_of(SV_LIT("\ntrailing;"), &delims, &before, &after);
+        MT_CHECK_THAT(before.length == 0);
+        MT_CHECK_THAT(sv_eq_cstr(after, "trailing;"));
+        sv_split_first_of(after, &delims, &before, &after);
+        MT_CHECK_THAT(sv_eq_cstr(before, "trailing"));
+        MT_CHECK_THAT(after.length == 0);
+    }
+    {
+        StringView before = SV_LIT("x"), after = SV_LIT("y");
+        sv_split_first_of(sv_empty(), &delims, &before, &after);
+        MT_CHECK_THAT(before.length == 0);
+        MT_CHECK_THAT(after.length == 0);
+        sv_split_first_of(SV_LIT("a,b"), &delims, NULL, NULL);
+    }
+}
+
+static size_t
+collect_fields(SvSplitIter *it, StringView *out, size_t cap)
+{
+    size_t n = 0;
+    StringView field;
+    while (n < cap && sv_split_next(it, &field)) out[n++] = field;
+    return n;
+}
+
+MT_DEFINE_TEST(split_iter_char)
+{
+    StringView  fields[8];
+    SvSplitIter it;
+
+    sv_split_iter_init_char(&it, SV_LIT("a,b,,c"), ',');
+    MT_ASSERT_THAT(collect_fields(&it, fields, 8) == 4);
+    MT_CHECK_THAT(sv_eq_cstr(fields[0], "a"));
+    MT_CHECK_THAT(sv_eq_cstr(fields[1], "b"));
+    MT_CHECK_THAT(sv_eq_cstr(fields[2], ""));
+    MT_CHECK_THAT(sv_eq_cstr(fields[3], "c"));
+    MT_CHECK_THAT(!sv_split_next(&it, &fields[0]));
+
+    sv_split_iter_init_char(&it, SV_LIT(",x,"), ',');
+    MT_ASSERT_THAT(collect_fields(&it, fields, 8) == 3);
+    MT_CHECK_THAT(fields[0].length == 0 && sv_eq_cstr(fields[1], "x") && fields[2].length == 0);
+
+    sv_split_iter_init_char(&it, sv_empty(), ',');
+    MT_CHECK_THAT(collect_fields(&it, fields, 8) == 1 && fields[0].length == 0);
+
+    sv_split_iter_init_char(&it, SV_LIT(",,a,,,b,,"), ',');
+    it.skip_empty = true;
+    MT_ASSERT_THAT(collect_fields(&it, fields, 8) == 2);
+    MT_CHECK_THAT(sv_eq_cstr(fields[0], "a") && sv_eq_cstr(fields[1], "b"));
+
+    sv_split_iter_init_char(&it, SV_LIT("k=v=w=x"), '=');
+    it.max_fields = 2;
+    MT_ASSERT_THAT(collect_fields(&it, fields, 8) == 2);
+    MT_CHECK_THAT(sv_eq_cstr(fields[0], "k") && sv_eq_cstr(fields[1], "v=w=x"));
+
+    sv_split_iter_init_char(&it, SV_LIT("  GET   /index.html  HTTP/1.1"), ' ');
+    it.skip_empty = true;
+    it.max_fields = 2;
+    MT_ASSERT_THAT(collect_fields(&it, fields, 8) == 2);
+    MT_CHECK_THAT(sv_eq_cstr(fields[0], "GET") && sv_eq_cstr(fields[1], "/index.html  HTTP/1.1"));
+
+    sv_split_iter_init_char(&it, SV_LIT("a,b"), ',');
+    it.max_fields = 1;
+    MT_CHECK_THAT(collect_fields(&it, fields, 8) == 1 && sv_eq_cstr(fields[0], "a,b"));
+}
+
+MT_DEFINE_TEST(split_iter_str_and_set)
+{
+    StringView  fields[8];
+    SvSplitIter it;
+
+    sv_split_iter_init_str(&it, SV_LIT("GET / HTTP/1.1\r\nHost: x\r\n\r\n"), SV_LIT("\r\n"));
+    MT_ASSERT_THAT(collect_fields(&it, fields, 8) == 4);
+    MT_CHECK_THAT(sv_eq_cstr(fields[0], "GET / HTTP/1.1"));
+    MT_CHECK_THAT(sv_eq_cstr(fields[1], "Host: x"));
+    MT_CHECK_THAT(fields[2].length == 0 && fields[3].length == 0);
+
+    sv_split_iter_init_str(&it, SV_LIT("std::vector::::iterator"), SV_LIT("::"));
+    it.skip_empty = true;
+    MT_ASSERT_THAT(collect_fields(&it, fields, 8) == 3);
+    MT_CHECK_THAT(sv_eq_cstr(fields[0], "std") && sv_eq_cstr(fields[1], "vector") && sv_eq_cstr(fields[2], "iterator"));
+
+    sv_split_iter_init_str(&it, SV_LIT("a::::b::c"), SV_LIT("::"));
+    it.skip_empty = true;
+    it.max_fields = 2;
+    MT_ASSERT_THAT(collect_fields(&it, fields, 8) == 2);
+    MT_CHECK_THAT(sv_eq_cstr(fields[0], "a") && sv_eq_cstr(fields[1], "b::c"));
+
+    sv_split_iter_init_str(&it, SV_LIT("abc"), sv_empty());
+    MT_CHECK_THAT(collect_fields(&it, fields, 8) == 1 && sv_eq_cstr(fields[0], "abc"));
+
+    SvByteSet ws;
+    sv_byteset_init(&ws, SV_LIT(" \t\n"));
+    sv_split_iter_init_set(&it, SV_LIT(" one\ttwo \n three "), &ws);
+    it.skip_empty = true;
+    MT_ASSERT_THAT(collect_fields(&it, fields, 8) == 3);
+    MT_CHECK_THAT(sv_eq_cstr(fields[0], "one") && sv_eq_cstr(fields[1], "two") && sv_eq_cstr(fields[2], "three"));
+
+    sv_split_iter_init_set(&it, SV_LIT("a b\tc"), &ws);
+    MT_ASSERT_THAT(collect_fields(&it, fields, 8) == 3);
+    MT_CHECK_THAT(sv_eq_cstr(fields[2], "c"));
+}
+
+MT_DEFINE_TEST(split_into)
+{
+    StringView fields[8];
+    size_t     next = 0;
+
+    MT_ASSERT_THAT(sv_split_into(SV_LIT("a,b,,c"), ',', fields, 8, &next) == 4);
+    MT_CHECK_THAT(next == SV_NPOS);
+    MT_CHECK_THAT(sv_eq_cstr(fields[0], "a") && sv_eq_cstr(fields[1], "b"));
+    MT_CHECK_THAT(fields[2].length == 0 && sv_eq_cstr(fields[3], "c"));
+
+    MT_CHECK_THAT(sv_split_into(sv_empty(), ',', fields, 8, &next) == 1 && fields[0].length == 0);
+    MT_CHECK_THAT(sv_split_into(SV_LIT("x,"), ',', fields, 8, NULL) == 2 && fields[1].length == 0);
+    MT_CHECK_THAT(sv_split_into(SV_LIT("x"), ',', fields, 0, &next) == 0 && next == 0);
+
+    // Full array: continue from *out_next
+    StringView sv = SV_LIT("1,2,3,4,5,");
+    MT_ASSERT_THAT(sv_split_into(sv, ',', fields, 2, &next) == 2);
+    MT_CHECK_THAT(sv_eq_cstr(fields[1], "2") && next == 4);
+    sv = sv_drop(sv, next);
+    MT_ASSERT_THAT(sv_split_into(sv, ',', fields, 3, &next) == 3);
+    MT_CHECK_THAT(sv_eq_cstr(fields[2], "5") && next == 6);
+    sv = sv_drop(sv, next);
+    MT_CHECK_THAT(sv_split_into(sv, ',', fields, 3, &next) == 1 && fields[0].length == 0 && next == SV_NPOS);
+}
+
+MT_DEFINE_TEST(split_into_matches_iter)
+{
+    // Fields spanning block boundaries, runs of delimiters, and every remainder length
+    char buf[300];
+    uint32_t state = 7u;
+    for (size_t i = 0; i < sizeof buf; ++i) {
+        state = state * 1103515245u + 12345u;
+        buf[i] = ((state >> 16) % 7 == 0) ? '|' : (char)('a' + (state >> 20) % 26);
+    }
+
+    bool ok = true;
+    for (size_t len = 0; len <= sizeof buf; len += 1) {
+        StringView  sv = sv_from_parts(buf, len);
+        StringView  got[16];
+        SvSplitIter it;
+        sv_split_iter_init_char(&it, sv, '|');
+
+        size_t next = 0;
+        while (next != SV_NPOS) {
+            StringView   rest = sv_drop(sv, next);
+            const size_t n    = sv_split_into(rest, '|', got, 16, &next);
+            for (size_t k = 0; k < n; ++k) {
+                StringView expected;
+                ok = ok && sv_split_next(&it, &expected);
+                ok = ok && got[k].begin == expected.begin && got[k].length == expected.length;
+            }
+            if (next != SV_NPOS) next += (size_t)(rest.begin - sv.begin);
+        }
+        StringView extra;
+        ok = ok && !sv_split_next(&it, &extra);
+    }
+    MT_CHECK_THAT(ok);
+}
+
+MT_DEFINE_TEST(line_iter)
+{
+    SvLineIter it;
+    StringView line;
+
+    sv_line_iter_init(&it, SV_LIT("one\r\ntwo\n\nthree\r"));
+    MT_ASSERT_THAT(sv_line_next(&it, &line) && sv_eq_cstr(line, "one"));
+    MT_ASSERT_THAT(sv_line_next(&it, &line) && sv_eq_cstr(line, "two"));
+    MT_ASSERT_THAT(sv_line_next(&it, &line) && line.length == 0);
+    MT_ASSERT_THAT(sv_line_next(&it, &line) && sv_eq_cstr(line, "three\r"));
+    MT_CHECK_THAT(!sv_line_next(&it, &line) && it.count == 4);
+
+    sv_line_iter_init(&it, SV_LIT("a\r\nb\n"));
+    it.keep_terminators = true;
+    MT_ASSERT_THAT(sv_line_next(&it, &line) && sv_eq_cstr(line, "a\r\n"));
+    MT_ASSERT_THAT(sv_line_next(&it, &line) && sv_eq_cstr(line, "b\n"));
+    MT_CHECK_THAT(!sv_line_next(&it, &line));
+
+    sv_line_iter_init(&it, sv_empty());
+    MT_CHECK_THAT(!sv_line_next(&it, &line));
+    sv_line_iter_init(&it, SV_LIT("\n"));
+    MT_CHECK_THAT(sv_line_next(&it, &line) && line.length == 0 && !sv_line_next(&it, &line));
+}
+
+MT_DEFINE_TEST(line_iter_batch_matches_next)
+{
+    char buf[400];
+    uint32_t state = 11u;
+    for (size_t i = 0; i < sizeof buf; ++i) {
+        state = state * 1103515245u + 12345u;
+        const uint32_t r = (state >> 16) % 9;
+        buf[i] = r == 0 ? '\n' : r == 1 ? '\r' : (char)('a' + (state >> 20) % 26);
+    }
+
+    bool ok = true;
+    for (size_t len = 0; len <= sizeof buf; len += 1) {
+        for (int keep = 0; keep < 2; ++keep) {
+            SvLineIter single;
+            SvLineIter batch;
+            sv_line_iter_init(&single, sv_from_parts(buf, len));
+            sv_line_iter_init(&batch, sv_from_parts(buf, len));
+            single.keep_terminators = batch.keep_terminators = keep != 0;
+
+            StringView got[7];
+            size_t     n;
+            while ((n = sv_line_next_batch(&batch, got, 7)) > 0) {
+                for (size_t k = 0; k < n; ++k) {
+                    StringView expected;
+                    ok = ok && sv_line_next(&single, &expected);
+                    ok = ok && got[k].begin == expected.begin && got[k].length == expected.length;
+                }
+            }
+            StringView extra;
+            ok = ok && !sv_line_next(&single, &extra) && single.count == batch.count;
+        }
+    }
+    MT_CHECK_THAT(ok);
+}
+
+MT_DEFINE_TEST(csv_basic)
+{
+    SvCsvReader r;
+    SvCsvField  f[8];
+
+    sv_csv_init(&r, SV_LIT("name,qty\r\n\"Smith, J\",3\r\n\"say \"\"hi\"\"\",\r\n\nlast,\"\""), NULL);
+
+    MT_ASSERT_THAT(sv_csv_next_record(&r, f, 8) == 2);
+    MT_CHECK_THAT(sv_eq_cstr(f[0].value, "name") && sv_eq_cstr(f[1].value, "qty"));
+    MT_CHECK_THAT(!f[0].last_in_record && f[1].last_in_record);
+
+    MT_ASSERT_THAT(sv_csv_next_record(&r, f, 8) == 2);
+    MT_CHECK_THAT(sv_eq_cstr(f[0].value, "Smith, J") && f[0].quoted && !f[0].needs_unescape);
+    MT_CHECK_THAT(sv_eq_cstr(f[1].value, "3") && !f[1].quoted);
+
+    MT_ASSERT_THAT(sv_csv_next_record(&r, f, 8) == 2);
+    MT_CHECK_THAT(sv_eq_cstr(f[0].value, "say \"\"hi\"\"") && f[0].needs_unescape);
+    MT_CHECK_THAT(f[1].value.length == 0);
+
+    char buf[16];
+    MT_CHECK_THAT(sv_eq_cstr(sv_csv_unescape(f[0].value, '"', buf, sizeof buf), "say \"hi\""));
+    MT_CHECK_THAT(sv_eq_cstr(sv_csv_unescape(f[0].value, '"', buf, 6), "say \"h"));
+
+    // Empty line is a record with one empty field
+    MT_ASSERT_THAT(sv_csv_next_record(&r, f, 8) == 1);
+    MT_CHECK_THAT(f[0].value.length == 0 && f[0].last_in_record);
+
+    MT_ASSERT_THAT(sv_csv_next_record(&r, f, 8) == 2);
+    MT_CHECK_THAT(sv_eq_cstr(f[0].value, "last") && f[1].value.length == 0 && f[1].quoted);
+
+    MT_CHECK_THAT(sv_csv_next_record(&r, f, 8) == 0);
+    MT_CHECK_THAT(!sv_csv_error(&r, NULL));
+
+    // Trailing newline does not add a record, truncated records report their size
+    sv_csv_init(&r, SV_LIT("a,b,c,d\n"), NULL);
+    MT_CHECK_THAT(sv_csv_next_record(&r, f, 2) == 4 && sv_eq_cstr(f[1].value, "b"));
+    MT_CHECK_THAT(sv_csv_next_record(&r, f, 2) == 0);
+
+    sv_csv_init(&r, sv_empty(), NULL);
+    MT_CHECK_THAT(sv_csv_next_record(&r, f, 8) == 0 && !sv_csv_error(&r, NULL));
+}
+
+MT_DEFINE_TEST(csv_options_and_errors)
+{
+    SvCsvReader  r;
+    SvCsvField   f[8];
+    SvCsvOptions tsv = sv_csv_default_options();
+    tsv.delimiter    = '\t';
+    tsv.crlf         = false;
+
+    sv_csv_init(&r, SV_LIT("a,b\tc\r\n'x'\t\n"), &tsv);
+    MT_ASSERT_THAT(sv_csv_next_record(&r, f, 8) == 2);
+    MT_CHECK_THAT(sv_eq_cstr(f[0].value, "a,b") && sv_eq_cstr(f[1].value, "c\r"));
+    MT_ASSERT_THAT(sv_csv_next_record(&r, f, 8) == 2);
+    MT_CHECK_THAT(sv_eq_cstr(f[0].value, "'x'") && f[1].value.length == 0);
+
+    // Custom quote and record terminator
+    SvCsvOptions semi = sv_csv_default_options();
+    semi.quote        = '\'';
+    semi.newline      = ';';
+    sv_csv_init(&r, SV_LIT("1,'2;3';4"), &semi);
+    MT_ASSERT_THAT(sv_csv_next_record(&r, f, 8) == 2);
+    MT_CHECK_THAT(sv_eq_cstr(f[1].value, "2;3"));
+    MT_ASSERT_THAT(sv_csv_next_record(&r, f, 8) == 1);
+    MT_CHECK_THAT(sv_eq_cstr(f[0].value, "4"));
+
+    size_t offset = 0;
+    sv_csv_init(&r, SV_LIT("ok,\"open\nstill open"), NULL);
+    MT_CHECK_THAT(sv_csv_next_record(&r, f, 8) == 0);
+    MT_CHECK_THAT(sv_csv_error(&r, &offset) && offset == 3);
+
+    sv_csv_init(&r, SV_LIT("a\n\"b\"x,c\n"), NULL);
+    MT_CHECK_THAT(sv_csv_next_record(&r, f, 8) == 1);
+    MT_CHECK_THAT(sv_csv_next_record(&r, f, 8) == 0);
+    MT_CHECK_THAT(sv_csv_error(&r, &offset) && offset == 2);
+
+    // Quoted field followed by CRLF, and by a lone '\r' at the end
+    sv_csv_init(&r, SV_LIT("\"a\"\r\n\"b\"\r"), NULL);
+    MT_CHECK_THAT(sv_csv_next_record(&r, f, 8) == 1 && sv_eq_cstr(f[0].value, "a"));
+    MT_CHECK_THAT(sv_csv_next_record(&r, f, 8) == 1 && sv_eq_cstr(f[0].value, "b"));
+    MT_CHECK_THAT(sv_csv_next_record(&r, f, 8) == 0 && !sv_csv_error(&r, NULL));
+}
+
 MT_DEFINE_TEST(to_cstr)
 {
     StringView sv = sv_from_cstr("Hello World");
@@ -1483,6 +2326,105 @@ MT_DEFINE_TEST(to_int64_format_errors)
     }
 }
 
+// The digit-at-a-time parsers sv_to_uint64/sv_to_int64 used before the
+// chunked fast path, kept as the reference for the differential test.
+static bool
+ref_to_uint64(StringView sv, uint64_t *out)
+{
+    if (sv.length == 0) return false;
+    const char *p = sv.begin;
+    size_t      n = sv.length;
+    if (*p == '+') { p++; if (--n == 0) return false; }
+
+    uint64_t acc = 0;
+    while (n--) {
+        const unsigned char c = (unsigned char)*p++;
+        if (c < '0' || c > '9') return false;
+        const uint32_t d = (uint32_t)(c - '0');
+        if (acc > UINT64_MAX / 10ULL || (acc == UINT64_MAX / 10ULL && d > UINT64_MAX % 10ULL)) return false;
+        acc = acc * 10ULL + d;
+    }
+    *out = acc;
+    return true;
+}
+
+static bool
+ref_to_int64(StringView sv, int64_t *out)
+{
+    if (sv.length == 0) return false;
+    const char *p   = sv.begin;
+    size_t      n   = sv.length;
+    bool        neg = false;
+    if (*p == '+' || *p == '-') { neg = *p == '-'; p++; if (--n == 0) return false; }
+
+    const uint64_t limit = neg ? (uint64_t)INT64_MAX + 1ULL : (uint64_t)INT64_MAX;
+    uint64_t       acc   = 0;
+    while (n--) {
+        const unsigned char c = (unsigned char)*p++;
+        if (c < '0' || c > '9') return false;
+        const uint32_t d = (uint32_t)(c - '0');
+        if (acc > limit / 10ULL || (acc == limit / 10ULL && d > limit % 10ULL)) return false;
+        acc = acc * 10ULL + d;
+    }
+    if (neg) *out = acc == limit ? INT64_MIN : -(int64_t)acc;
+    else     *out = (int64_t)acc;
+    return true;
+}
+
+MT_DEFINE_TEST(to_int_matches_reference)
+{
+    static const char *const edges[] = {
+        "18446744073709551615", "18446744073709551616", "18446744073709551610",
+        "19999999999999999999", "99999999999999999999", "100000000000000000000",
+        "9223372036854775807", "9223372036854775808", "-9223372036854775808",
+        "-9223372036854775809", "0000000000000000000000000018446744073709551615",
+        "00000000000000000000000000000000", "+0000000000000000", "-0", "+", "-", "",
+        "1234567812345678", "12345678123456789", "123456781234567x", "12345678/2345678",
+        "1234567:", "00000000:0000000"
+    };
+
+    bool ok = true;
+    for (size_t i = 0; i < sizeof edges / sizeof edges[0]; ++i) {
+        const StringView sv = sv_from_cstr(edges[i]);
+        uint64_t u = 1, ru = 2;
+        int64_t  s = 1, rs = 2;
+        const bool got_u = sv_to_uint64(sv, &u), want_u = ref_to_uint64(sv, &ru);
+        const bool got_s = sv_to_int64(sv, &s),  want_s = ref_to_int64(sv, &rs);
+        ok = ok && got_u == want_u && (!got_u || u == ru);
+        ok = ok && got_s == want_s && (!got_s || s == rs);
+    }
+    MT_CHECK_THAT(ok);
+
+    // Random strings: mostly digits, with signs, leading zeros and the
+    // occasional byte just outside '0'..'9' at every position.
+    char     buf[40];
+    uint32_t state = 2024u;
+    for (int iter = 0; iter < 200000 && ok; ++iter) {
+        state = state * 1103515245u + 12345u;
+        const size_t len   = (state >> 16) % 26;
+        size_t       n     = 0;
+        const uint32_t kind = (state >> 8) % 8;
+        if (kind == 0) buf[n++] = '-';
+        if (kind == 1) buf[n++] = '+';
+        const size_t zeros = kind == 2 ? (state >> 4) % 12 : 0;
+        for (size_t k = 0; k < zeros; ++k) buf[n++] = '0';
+        for (size_t k = 0; k < len; ++k) {
+            state = state * 1103515245u + 12345u;
+            const uint32_t r = (state >> 16) % 200;
+            buf[n++] = r == 0 ? '/' : r == 1 ? ':' : r == 2 ? 'a' : r == 3 ? '\0' : (char)('0' + r % 10);
+        }
+
+        const StringView sv = sv_from_parts(buf, n);
+        uint64_t u = 1, ru = 2;
+        int64_t  s = 1, rs = 2;
+        const bool got_u = sv_to_uint64(sv, &u), want_u = ref_to_uint64(sv, &ru);
+        const bool got_s = sv_to_int64(sv, &s),  want_s = ref_to_int64(sv, &rs);
+        ok = ok && got_u == want_u && (!got_u || u == ru);
+        ok = ok && got_s == want_s && (!got_s || s == rs);
+    }
+    MT_CHECK_THAT(ok);
+}
+
 MT_DEFINE_TEST(to_long_basic)
 {
     {
@@ -1567,6 +2509,90 @@ double_eq_epsilon(double a, double b, double epsilon)
 }
 
 
+MT_DEFINE_TEST(to_int_base)
+{
+    uint64_t u = 0;
+    int64_t  i = 0;
+
+    MT_CHECK_THAT(sv_to_uint64_base(SV_LIT("ff"), 16, &u) && u == 255);
+    MT_CHECK_THAT(sv_to_uint64_base(SV_LIT("0xDeadBeef"), 16, &u) && u == 0xDEADBEEFULL);
+    MT_CHECK_THAT(sv_to_uint64_base(SV_LIT("0xffffffffffffffff"), 0, &u) && u == UINT64_MAX);
+    MT_CHECK_THAT(sv_to_uint64_base(SV_LIT("0x00000000000000000000000000000001"), 0, &u) && u == 1);
+    MT_CHECK_THAT(!sv_to_uint64_base(SV_LIT("0x10000000000000000"), 0, &u));
+    MT_CHECK_THAT(sv_to_uint64_base(SV_LIT("0b1011"), 0, &u) && u == 11);
+    MT_CHECK_THAT(sv_to_uint64_base(SV_LIT("0b1011"), 16, &u) && u == 0xB1011ULL);
+    MT_CHECK_THAT(sv_to_uint64_base(SV_LIT("0o777"), 0, &u) && u == 511);
+    MT_CHECK_THAT(sv_to_uint64_base(SV_LIT("0777"), 0, &u) && u == 777);
+    MT_CHECK_THAT(sv_to_uint64_base(SV_LIT("777"), 8, &u) && u == 511);
+    MT_CHECK_THAT(sv_to_uint64_base(SV_LIT("zz"), 36, &u) && u == 35 * 36 + 35);
+    MT_CHECK_THAT(sv_to_uint64_base(SV_LIT("3w5e11264sgsf"), 36, &u) && u == UINT64_MAX);
+    MT_CHECK_THAT(!sv_to_uint64_base(SV_LIT("3w5e11264sgsg"), 36, &u));
+    MT_CHECK_THAT(sv_to_uint64_base(SV_LIT("1111111111111111111111111111111111111111111111111111111111111111"), 2, &u));
+    MT_CHECK_THAT(u == UINT64_MAX);
+    MT_CHECK_THAT(!sv_to_uint64_base(SV_LIT("11111111111111111111111111111111111111111111111111111111111111111"), 2, &u));
+
+    // Invalid input
+    MT_CHECK_THAT(!sv_to_uint64_base(SV_LIT("0x"), 0, &u));
+    MT_CHECK_THAT(!sv_to_uint64_base(SV_LIT("12"), 2, &u));
+    MT_CHECK_THAT(!sv_to_uint64_base(SV_LIT("g"), 16, &u));
+    MT_CHECK_THAT(!sv_to_uint64_base(SV_LIT("12345678901234g"), 16, &u));
+    MT_CHECK_THAT(!sv_to_uint64_base(SV_LIT(" 1"), 16, &u));
+    MT_CHECK_THAT(!sv_to_uint64_base(SV_LIT("1"), 1, &u));
+    MT_CHECK_THAT(!sv_to_uint64_base(SV_LIT("1"), 37, &u));
+    MT_CHECK_THAT(!sv_to_uint64_base(SV_LIT("-1"), 10, &u));
+    MT_CHECK_THAT(!sv_to_uint64_base(SV_LIT("+"), 0, &u));
+
+    MT_CHECK_THAT(sv_to_int64_base(SV_LIT("-0x8000000000000000"), 0, &i) && i == INT64_MIN);
+    MT_CHECK_THAT(!sv_to_int64_base(SV_LIT("0x8000000000000000"), 0, &i));
+    MT_CHECK_THAT(sv_to_int64_base(SV_LIT("+0x7fffffffffffffff"), 0, &i) && i == INT64_MAX);
+    MT_CHECK_THAT(sv_to_int64_base(SV_LIT("-101"), 2, &i) && i == -5);
+    MT_CHECK_THAT(sv_to_int64_base(SV_LIT("-42"), 0, &i) && i == -42);
+    MT_CHECK_THAT(!sv_to_int64_base(SV_LIT("-"), 0, &i));
+
+    // Every length of hex string agrees with a scalar reference
+    static const char hex[] = "0123456789abcdefABCDEF";
+    char     buf[20];
+    uint32_t state = 5u;
+    bool     ok    = true;
+    for (int iter = 0; iter < 20000; ++iter) {
+        state = state * 1103515245u + 12345u;
+        const size_t len = 1 + (state >> 16) % 18;
+        uint64_t want  = 0;
+        size_t   sig   = 0;
+        bool     valid = true;
+        for (size_t k = 0; k < len; ++k) {
+            state = state * 1103515245u + 12345u;
+            const uint32_t r = (state >> 16) % 23;
+            buf[k] = r == 22 ? 'g' : hex[r];
+            if (r == 22) valid = false;
+            if (sig > 0 || r != 0) sig += 1;
+            want = want << 4 | (uint64_t)(r < 16 ? r : r - 6);
+        }
+        if (sig > 16) valid = false;
+        uint64_t got = 0;
+        const bool res = sv_to_uint64_base(sv_from_parts(buf, len), 16, &got);
+        ok = ok && res == valid && (!res || got == want);
+    }
+    MT_CHECK_THAT(ok);
+}
+
+MT_DEFINE_TEST(hex_decode)
+{
+    unsigned char out[20];
+
+    MT_ASSERT_THAT(sv_hex_decode(SV_LIT("4bf92f3577b34da6a3ce929d0e0e4736"), out, sizeof out) == 16);
+    MT_CHECK_THAT(out[0] == 0x4B && out[7] == 0xA6 && out[8] == 0xA3 && out[15] == 0x36);
+    MT_ASSERT_THAT(sv_hex_decode(SV_LIT("00FFaB10e7"), out, 5) == 5);
+    MT_CHECK_THAT(out[1] == 0xFF && out[2] == 0xAB && out[4] == 0xE7);
+    MT_CHECK_THAT(sv_hex_decode(sv_empty(), out, 0) == 0);
+
+    MT_CHECK_THAT(sv_hex_decode(SV_LIT("abc"), out, sizeof out) == SV_NPOS);
+    MT_CHECK_THAT(sv_hex_decode(SV_LIT("abcd"), out, 1) == SV_NPOS);
+    MT_CHECK_THAT(sv_hex_decode(SV_LIT("4bf92f3577b34da6a3ce929d0e0e473G"), out, sizeof out) == SV_NPOS);
+    MT_CHECK_THAT(sv_hex_decode(SV_LIT("4bf92f3577b3 da6"), out, sizeof out) == SV_NPOS);
+    MT_CHECK_THAT(sv_hex_decode(SV_LIT("4bf92f3577b34da6:f"), out, sizeof out) == SV_NPOS);
+}
+
 MT_DEFINE_TEST(to_double_basic)
 {
     {
@@ -1692,6 +2718,301 @@ MT_DEFINE_TEST(to_double_precision_paths)
     }
 }
 
+MT_DEFINE_TEST(to_double_correctly_rounded)
+{
+    static const char *const hard[] = {
+        "0.1", "0.3", "1e23", "9007199254740993", "9007199254740992.5",
+        "2.2250738585072011e-308", "2.2250738585072012e-308",  // largest subnormal / smallest normal
+        "4.9406564584124654e-324", "2.4703282292062327e-324", "2.4703282292062328e-324",
+        "1.7976931348623157e308", "1.7976931348623158e308",
+        "7.3177701707893310e+15", "8.98846567431158e307",
+        "123456789012345678901234567890", "0.000000000000000000000000000001",
+        // Exactly halfway between 1 and the next double, and just either side of it
+        "1.00000000000000011102230246251565404236316680908203125",
+        "1.00000000000000011102230246251565404236316680908203124",
+        "1.000000000000000111022302462515654042363166809082031250000000000000000000000001",
+        // Halfway between the two largest subnormals, needing all 767 significant digits
+        "2.2250738585072008890245868760858598876504231122409594654935248025624400092282356951787758888037591552642309780950434312085877387158357291821993020294379224223559819827501242041788969571311791082261043971979604000454897391938079198936081525613113376149842043271751033627391549782731594143828136275113838604094249464942286316695429105080201815926642134996606517803095075913058719846423906068637102005108723282784678843631944515866135041223479014792369585208321597621066375401613736583044193603714778355306682834535634005074073040135602968046375918583163124224521599262546494300836851861719422417646455137135420132217031370496583210154654068035397417906022589503023501937519773030945763173210852507299305089761582519159720757232455434770912461317493580281734466552734375e-308",
+        "1e-400", "0e99999", "-0.0"
+    };
+
+    bool ok = true;
+    for (size_t i = 0; i < sizeof hard / sizeof hard[0]; ++i) {
+        double got = 0.0;
+        const double want = strtod(hard[i], NULL);
+        ok = ok && sv_to_double(sv_from_cstr(hard[i]), &got) && memcmp(&got, &want, sizeof got) == 0;
+    }
+    MT_CHECK_THAT(ok);
+
+    double x;
+    MT_CHECK_THAT(!sv_to_double(SV_LIT("1.7976931348623159e308"), &x));
+    MT_CHECK_THAT(!sv_to_double(SV_LIT("179769313486231580793728971405303415079934132710037826936173778980444968292764750946649017977587207096330286416692887910946555547851940402630657488671505820681908902000708383676273854845817711531764475730270069855571366959622842914819860834936475292719074168444365510704342711559699508093042880177904174497792"), &x));
+
+    // Random digit strings and exponents, checked bit for bit against strtod
+    char     buf[64];
+    uint32_t state = 31337u;
+    for (int iter = 0; iter < 100000 && ok; ++iter) {
+        size_t n = 0;
+        state = state * 1103515245u + 12345u;
+        const size_t digits = 1 + (state >> 16) % 30;
+        const size_t dot    = (state >> 8) % (digits + 1);
+        for (size_t k = 0; k < digits; ++k) {
+            if (k == dot && k > 0) buf[n++] = '.';
+            state = state * 1103515245u + 12345u;
+            buf[n++] = (char)('0' + (state >> 16) % 10);
+        }
+        state = state * 1103515245u + 12345u;
+        n += (size_t)snprintf(buf + n, sizeof buf - n, "e%d", (int)((state >> 16) % 700) - 350);
+
+        double       got  = 0.0;
+        const double want = strtod(buf, NULL);
+        const bool   res  = sv_to_double(sv_from_parts(buf, n), &got);
+        ok = isinf(want) ? !res : res && memcmp(&got, &want, sizeof got) == 0;
+    }
+    MT_CHECK_THAT(ok);
+}
+
+MT_DEFINE_TEST(fmt_int)
+{
+    char       buf[SV_FMT_INT64_LEN];
+    StringView sv;
+
+    sv = sv_fmt_uint64(0, buf, sizeof buf);
+    MT_CHECK_THAT(sv.begin == buf && sv_eq(sv, SV_LIT("0")));
+    MT_CHECK_THAT(sv_eq(sv_fmt_uint64(UINT64_MAX, buf, sizeof buf), SV_LIT("18446744073709551615")));
+    MT_CHECK_THAT(sv_eq(sv_fmt_int64(INT64_MIN, buf, sizeof buf), SV_LIT("-9223372036854775808")));
+    MT_CHECK_THAT(sv_eq(sv_fmt_int64(-7, buf, sizeof buf), SV_LIT("-7")));
+
+    // Too small writes nothing
+    buf[0] = 'x';
+    sv = sv_fmt_int64(-10, buf, 2);
+    MT_CHECK_THAT(sv.length == 0 && buf[0] == 'x');
+    MT_CHECK_THAT(sv_fmt_uint64(100, buf, 3).length == 3);
+    MT_CHECK_THAT(sv_fmt_uint64(1, NULL, 0).length == 0);
+
+    // Every length and the boundaries around powers of ten agree with snprintf
+    char     want[32];
+    bool     ok = true;
+    uint64_t p  = 1;
+    for (int k = 0; k < 20; ++k, p *= 10) {
+        const uint64_t vals[3] = { p - 1, p, p + 1 };
+        for (int j = 0; j < 3; ++j) {
+            snprintf(want, sizeof want, "%" PRIu64, vals[j]);
+            ok = ok && sv_eq(sv_fmt_uint64(vals[j], buf, sizeof buf), sv_from_cstr(want));
+            snprintf(want, sizeof want, "%" PRId64, -(int64_t)(vals[j] >> 1));
+            ok = ok && sv_eq(sv_fmt_int64(-(int64_t)(vals[j] >> 1), buf, sizeof buf), sv_from_cstr(want));
+        }
+    }
+    uint64_t state = 88172645463325252ULL;
+    for (int iter = 0; iter < 100000 && ok; ++iter) {
+        state ^= state << 13; state ^= state >> 7; state ^= state << 17;
+        const uint64_t v = state >> (state % 64);
+        snprintf(want, sizeof want, "%" PRIu64, v);
+        ok = sv_eq(sv_fmt_uint64(v, buf, sizeof buf), sv_from_cstr(want));
+        snprintf(want, sizeof want, "%" PRId64, (int64_t)v);
+        ok = ok && sv_eq(sv_fmt_int64((int64_t)v, buf, sizeof buf), sv_from_cstr(want));
+    }
+    MT_CHECK_THAT(ok);
+}
+
+MT_DEFINE_TEST(fmt_double)
+{
+    char buf[SV_FMT_DOUBLE_LEN];
+
+    static const struct { double value; const char *text; } cases[] = {
+        { 0.0, "0" }, { 1.0, "1" }, { -1.5, "-1.5" }, { 0.1, "0.1" }, { 0.3, "0.3" },
+        { 1.0 / 3.0, "0.3333333333333333" }, { 123.456, "123.456" }, { 100.0, "100" },
+        { 1e21, "1e+21" }, { 1e20, "100000000000000000000" }, { 1e23, "1e+23" },
+        { 0.000001, "0.000001" }, { 1e-7, "1e-7" }, { 1.5e300, "1.5e+300" },
+        { 9007199254740993.0, "9007199254740992" }, { 5e-324, "5e-324" },
+        { 2.2250738585072014e-308, "2.2250738585072014e-308" },
+        { 1.7976931348623157e308, "1.7976931348623157e+308" },
+        { -0.0000012345678901234567, "-0.0000012345678901234567" },
+    };
+    bool ok = true;
+    for (size_t i = 0; i < sizeof cases / sizeof cases[0]; ++i) {
+        ok = ok && sv_eq(sv_fmt_double(cases[i].value, buf, sizeof buf), sv_from_cstr(cases[i].text));
+    }
+    MT_CHECK_THAT(ok);
+
+    MT_CHECK_THAT(sv_eq(sv_fmt_double(-0.0, buf, sizeof buf), SV_LIT("-0")));
+    MT_CHECK_THAT(sv_eq(sv_fmt_double(HUGE_VAL, buf, sizeof buf), SV_LIT("inf")));
+    MT_CHECK_THAT(sv_eq(sv_fmt_double(-HUGE_VAL, buf, sizeof buf), SV_LIT("-inf")));
+    MT_CHECK_THAT(sv_eq(sv_fmt_double(NAN, buf, sizeof buf), SV_LIT("nan")));
+    MT_CHECK_THAT(sv_fmt_double(0.25, buf, 3).length == 0);
+    MT_CHECK_THAT(sv_fmt_double(0.25, buf, 4).length == 4);
+
+    // Random bit patterns round-trip, and no shorter %.*e output does
+    char     want[40];
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (int iter = 0; iter < 100000 && ok; ++iter) {
+        state ^= state << 13; state ^= state >> 7; state ^= state << 17;
+        double value;
+        memcpy(&value, &state, sizeof value);
+        if (isnan(value) || isinf(value)) continue;
+
+        const StringView sv = sv_fmt_double(value, buf, sizeof buf);
+        double back = 0.0;
+        ok = sv_to_double(sv, &back) && memcmp(&back, &value, sizeof back) == 0;
+
+        // Significant digits, from the first to the last non-zero one
+        size_t digits = 0, seen = 0;
+        for (size_t i = 0; i < sv.length && sv.begin[i] != 'e'; ++i) {
+            if (sv.begin[i] < '0' || sv.begin[i] > '9' || (seen == 0 && sv.begin[i] == '0')) continue;
+            seen += 1;
+            if (sv.begin[i] != '0') digits = seen;
+        }
+        if (digits > 1 && iter % 8 == 0) {
+            snprintf(want, sizeof want, "%.*e", (int)digits - 2, value);
+            ok = ok && strtod(want, NULL) != value;
+        }
+    }
+    MT_CHECK_THAT(ok);
+}
+
+MT_DEFINE_TEST(parse_prefix)
+{
+    uint64_t u = 0;
+    int64_t  i = 0;
+    double   d = 0.0;
+    size_t   used = 99;
+
+    MT_CHECK_THAT(sv_parse_uint64_prefix(SV_LIT("123;"), &u, &used) && u == 123 && used == 3);
+    MT_CHECK_THAT(sv_parse_uint64_prefix(SV_LIT("+0012345678901234567890x"), &u, &used) && used == 23);
+    MT_CHECK_THAT(u == 12345678901234567890ULL);
+    MT_CHECK_THAT(!sv_parse_uint64_prefix(SV_LIT("18446744073709551616 "), &u, &used) && used == 0);
+    MT_CHECK_THAT(!sv_parse_uint64_prefix(SV_LIT("-1"), &u, &used) && used == 0);
+    MT_CHECK_THAT(!sv_parse_uint64_prefix(SV_LIT("+x"), &u, &used) && used == 0);
+    MT_CHECK_THAT(!sv_parse_uint64_prefix(sv_empty(), &u, &used));
+
+    MT_CHECK_THAT(sv_parse_int64_prefix(SV_LIT("-9223372036854775808]"), &i, &used) && i == INT64_MIN && used == 20);
+    MT_CHECK_THAT(!sv_parse_int64_prefix(SV_LIT("9223372036854775808"), &i, NULL));
+    MT_CHECK_THAT(sv_parse_int64_prefix(SV_LIT("42"), &i, NULL) && i == 42);
+
+    MT_CHECK_THAT(sv_parse_double_prefix(SV_LIT("12.5ms"), &d, &used) && d == 12.5 && used == 4);
+    MT_CHECK_THAT(sv_parse_double_prefix(SV_LIT("2.x"), &d, &used) && d == 2.0 && used == 1);
+    MT_CHECK_THAT(sv_parse_double_prefix(SV_LIT("2e+"), &d, &used) && d == 2.0 && used == 1);
+    MT_CHECK_THAT(sv_parse_double_prefix(SV_LIT("-.5e1,"), &d, &used) && d == -5.0 && used == 5);
+    MT_CHECK_THAT(sv_parse_double_prefix(SV_LIT("1e-3e"), &d, &used) && d == 0.001 && used == 4);
+    MT_CHECK_THAT(!sv_parse_double_prefix(SV_LIT(".e1"), &d, &used) && used == 0);
+    MT_CHECK_THAT(!sv_parse_double_prefix(SV_LIT("1e999 "), &d, &used) && used == 0);
+
+    // Every prefix parse of a full number agrees with the strict parser
+    static const char *const nums[] = { "0", "-0.0", "3.25", "1e10", "+7E-2", "123456789012345678901" };
+    bool ok = true;
+    for (size_t k = 0; k < sizeof nums / sizeof nums[0]; ++k) {
+        double a = 1.0, b = 2.0;
+        const StringView sv = sv_from_cstr(nums[k]);
+        ok = ok && sv_to_double(sv, &a) && sv_parse_double_prefix(sv, &b, &used);
+        ok = ok && used == sv.length && memcmp(&a, &b, sizeof a) == 0;
+    }
+    MT_CHECK_THAT(ok);
+}
+
+MT_DEFINE_TEST(parse_and_consume)
+{
+    StringView in = SV_LIT("key=123;t=-4;rate=0.25ms");
+    StringView key;
+    uint64_t   u;
+    int64_t    i;
+    double     d;
+
+    sv_split_first(in, '=', &key, &in);
+    MT_ASSERT_THAT(sv_parse_uint64_and_consume(&in, &u) && u == 123);
+    MT_CHECK_THAT(sv_eq_cstr(in, ";t=-4;rate=0.25ms"));
+    in = sv_drop(in, 3);
+    MT_ASSERT_THAT(sv_parse_int64_and_consume(&in, &i) && i == -4);
+    in = sv_drop(in, 6);
+    MT_ASSERT_THAT(sv_parse_double_and_consume(&in, &d) && d == 0.25);
+    MT_CHECK_THAT(sv_eq_cstr(in, "ms"));
+
+    // Failure leaves the view alone
+    MT_CHECK_THAT(!sv_parse_double_and_consume(&in, &d) && sv_eq_cstr(in, "ms"));
+    MT_CHECK_THAT(!sv_parse_uint64_and_consume(&in, &u) && sv_eq_cstr(in, "ms"));
+}
+
+MT_DEFINE_TEST(parse_batch)
+{
+    const StringView values[] = {
+        SV_LIT("12"), SV_LIT("-7"), SV_LIT(""), SV_LIT("+123456789012"), SV_LIT("9223372036854775807"),
+        SV_LIT("-9223372036854775808"), SV_LIT("9223372036854775808"), SV_LIT("1.5"), SV_LIT("-"),
+        SV_LIT("00000000000000000000042")
+    };
+    const size_t count = sizeof values / sizeof values[0];
+    int64_t      ints[10];
+    double       dbls[10];
+    uint8_t      valid[2] = { 0xFF, 0xFF };
+
+    MT_CHECK_THAT(sv_parse_int64_batch(values, count, ints, valid) == 2);
+    MT_CHECK_THAT(valid[0] == 0x3B && valid[1] == 0x02);
+    MT_CHECK_THAT(ints[0] == 12 && ints[1] == -7 && ints[2] == 0 && ints[3] == 123456789012LL);
+    MT_CHECK_THAT(ints[4] == INT64_MAX && ints[5] == INT64_MIN && ints[6] == 0 && ints[9] == 42);
+
+    MT_CHECK_THAT(sv_parse_double_batch(values, count, dbls, valid) == 2);
+    MT_CHECK_THAT(valid[0] == 0xFB && valid[1] == 0x02);
+    MT_CHECK_THAT(dbls[7] == 1.5 && dbls[8] == 0.0);
+    MT_CHECK_THAT(sv_parse_double_batch(values, 2, dbls, NULL) == SV_NPOS);
+
+    // Agrees with sv_to_int64 on random short strings
+    StringView vs[64];
+    char       text[64][24];
+    uint32_t   state = 99u;
+    bool       ok    = true;
+    for (int round = 0; round < 500; ++round) {
+        for (size_t k = 0; k < 64; ++k) {
+            state = state * 1103515245u + 12345u;
+            const size_t len = (state >> 16) % 22;
+            for (size_t c = 0; c < len; ++c) {
+                state = state * 1103515245u + 12345u;
+                const uint32_t r = (state >> 16) % 60;
+                text[k][c] = r == 0 ? '-' : r == 1 ? 'x' : (char)('0' + r % 10);
+            }
+            vs[k] = sv_from_parts(text[k], len);
+        }
+        uint8_t bits[8];
+        int64_t out64[64];
+        const size_t first = sv_parse_int64_batch(vs, 64, out64, bits);
+        size_t want_first = SV_NPOS;
+        for (size_t k = 0; k < 64; ++k) {
+            int64_t    want = 0;
+            const bool good = sv_to_int64(vs[k], &want);
+            if (!good) want = 0;
+            if (!good && want_first == SV_NPOS) want_first = k;
+            ok = ok && out64[k] == want && ((bits[k / 8] >> (k % 8)) & 1) == (good ? 1 : 0);
+        }
+        ok = ok && first == want_first;
+    }
+    MT_CHECK_THAT(ok);
+}
+
+MT_DEFINE_TEST(parse_fields)
+{
+    int64_t ints[200];
+    double  dbls[4];
+    uint8_t valid[25];
+    size_t  next = 0;
+    size_t  err  = 0;
+
+    MT_CHECK_THAT(sv_parse_int64_fields(SV_LIT("1,-2,x,4"), ',', ints, valid, 200, &next, &err) == 4);
+    MT_CHECK_THAT(next == SV_NPOS && err == 2 && valid[0] == 0x0B && ints[3] == 4);
+
+    MT_CHECK_THAT(sv_parse_double_fields(SV_LIT("0.5|2e3|7|8"), '|', dbls, NULL, 3, &next, &err) == 3);
+    MT_CHECK_THAT(next == 10 && err == SV_NPOS && dbls[1] == 2000.0);
+
+    // More fields than one internal chunk; bitmap bytes line up across chunks
+    char   buf[600];
+    size_t n = 0;
+    for (int k = 0; k < 150; ++k) n += (size_t)snprintf(buf + n, sizeof buf - n, k == 130 ? "?;" : "%d;", k);
+    n -= 1;
+    MT_ASSERT_THAT(sv_parse_int64_fields(sv_from_parts(buf, n), ';', ints, valid, 200, &next, &err) == 150);
+    MT_CHECK_THAT(next == SV_NPOS && err == 130 && ints[149] == 149 && ints[64] == 64);
+    MT_CHECK_THAT(valid[16] == 0xFB && valid[15] == 0xFF && valid[18] == 0x3F);
+
+    MT_CHECK_THAT(sv_parse_int64_fields(sv_from_parts(buf, n), ';', ints, valid, 100, &next, &err) == 100);
+    MT_CHECK_THAT(next == 290 && err == SV_NPOS);
+    MT_CHECK_THAT(sv_parse_int64_fields(SV_LIT("1"), ';', ints, valid, 0, &next, NULL) == 0 && next == 0);
+}
+
 MT_DEFINE_TEST(to_double_signed_zero)
 {
     {
@@ -1707,6 +3028,489 @@ MT_DEFINE_TEST(to_double_signed_zero)
 }
 
 
+MT_DEFINE_TEST(hash)
+{
+    // Values of earlier releases, which must never change
+    MT_CHECK_THAT(sv_hash_fnv1a(sv_empty()) == 0x14650fb0739d0383ULL);
+    MT_CHECK_THAT(sv_hash_fnv1a(SV_LIT("a")) == 0x44bd8ad473cd9906ULL);
+    MT_CHECK_THAT(sv_hash_fnv1a(SV_LIT("foobar")) == 0x88fad7c0a8ff07f2ULL);
+#ifndef SV_HASH_WYHASH
+    MT_CHECK_THAT(sv_hash(SV_LIT("foobar")) == 0x88fad7c0a8ff07f2ULL);
+#else
+    MT_CHECK_THAT(sv_hash(SV_LIT("foobar")) == sv_hash64_seeded(SV_LIT("foobar"), 0));
+#endif
+
+    // wyhash final4 test vectors, seeded with their index
+    static const struct { const char *text; uint64_t hash; } vectors[] = {
+        { "", 0x93228a4de0eec5a2ULL },
+        { "a", 0xc5bac3db178713c4ULL },
+        { "abc", 0xa97f2f7b1d9b3314ULL },
+        { "message digest", 0x786d1f1df3801df4ULL },
+        { "abcdefghijklmnopqrstuvwxyz", 0xdca5a8138ad37c87ULL },
+        { "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", 0xb9e734f117cfaf70ULL },
+        { "12345678901234567890123456789012345678901234567890123456789012345678901234567890", 0x6cc5eab49a92d617ULL },
+    };
+    bool ok = true;
+    for (size_t i = 0; i < sizeof vectors / sizeof vectors[0]; ++i) {
+        ok = ok && sv_hash64_seeded(sv_from_cstr(vectors[i].text), i) == vectors[i].hash;
+    }
+    MT_CHECK_THAT(ok);
+
+    // Only the viewed bytes are hashed, every length and every seed bit matters
+    char buf[160];
+    for (size_t i = 0; i < sizeof buf; ++i) buf[i] = (char)(i * 7 + 1);
+    const StringView all = sv_from_parts(buf, sizeof buf);
+    for (size_t n = 0; n < 100 && ok; ++n) {
+        const StringView sv   = sv_from_parts(buf + 3, n);
+        const uint64_t   h    = sv_hash64_seeded(sv, 42);
+        const SvHash128  wide = sv_hash128_seeded(sv, 42);
+        ok = h == sv_hash64_seeded(sv_substr(all, 3, n), 42) && wide.lo == h && wide.hi != h;
+        ok = ok && h != sv_hash64_seeded(sv_from_parts(buf + 3, n + 1), 42);
+        ok = ok && h != sv_hash64_seeded(sv, 43) && h != sv_hash64_seeded(sv, 42 | (1ULL << 63));
+        if (n > 0) {
+            buf[3 + n - 1] ^= 1;
+            ok = ok && h != sv_hash64_seeded(sv, 42) && wide.hi != sv_hash128_seeded(sv, 42).hi;
+            buf[3 + n - 1] ^= 1;
+        }
+    }
+    MT_CHECK_THAT(ok);
+}
+
+MT_DEFINE_TEST(hasher_matches_oneshot)
+{
+    char buf[300];
+    for (size_t i = 0; i < sizeof buf; ++i) buf[i] = (char)(i * 131 + 7);
+
+    // Every length, split at pseudo-random points into up to 5 pieces
+    bool     ok    = true;
+    uint32_t state = 12345u;
+    for (size_t n = 0; n <= sizeof buf && ok; ++n) {
+        for (int rep = 0; rep < 8 && ok; ++rep) {
+            SvHasher fnv, wy;
+            sv_hasher_init(&fnv, SV_HASHER_FNV1A, 0);
+            sv_hasher_init(&wy, SV_HASHER_WYHASH, n);
+
+            size_t pos = 0;
+            for (int piece = 0; piece < 5 && pos < n; ++piece) {
+                state = state * 1103515245u + 12345u;
+                const size_t take = piece == 4 ? n - pos : (state >> 16) % (n - pos + 1);
+                sv_hasher_update(&fnv, sv_from_parts(buf + pos, take));
+                sv_hasher_update(&wy, sv_from_parts(buf + pos, take));
+                pos += take;
+            }
+            sv_hasher_update(&fnv, sv_from_parts(buf + pos, n - pos));
+            sv_hasher_update(&wy, sv_from_parts(buf + pos, n - pos));
+
+            const StringView all = sv_from_parts(buf, n);
+            ok = sv_hasher_final(&fnv) == sv_hash_fnv1a(all) && sv_hasher_final(&wy) == sv_hash64_seeded(all, n);
+        }
+    }
+    MT_CHECK_THAT(ok);
+
+    // final can be taken mid-stream, and empty updates change nothing
+    SvHasher h;
+    sv_hasher_init(&h, SV_HASHER_WYHASH, 9);
+    sv_hasher_update(&h, SV_LIT("user:"));
+    MT_CHECK_THAT(sv_hasher_final(&h) == sv_hash64_seeded(SV_LIT("user:"), 9));
+    sv_hasher_update(&h, sv_empty());
+    sv_hasher_update(&h, SV_LIT("42"));
+    MT_CHECK_THAT(sv_hasher_final(&h) == sv_hash64_seeded(SV_LIT("user:42"), 9));
+}
+
+MT_DEFINE_TEST(hash_batch)
+{
+    char buf[512];
+    for (size_t i = 0; i < sizeof buf; ++i) buf[i] = (char)(i * 37 + 11);
+
+    // Mixed short lengths, a count that is not a multiple of the group size,
+    // and a few long keys next to empty ones
+    StringView keys[203];
+    uint64_t   out[203];
+    uint32_t   state = 777u;
+    for (size_t i = 0; i < 203; ++i) {
+        state               = state * 1103515245u + 12345u;
+        const size_t start  = (state >> 8) % 64;
+        const size_t length = i % 29 == 0 ? 300 + i % 100 : i % 17 == 0 ? 0 : (state >> 16) % 61;
+        keys[i]             = sv_from_parts(buf + start, length);
+    }
+
+    for (size_t n = 0; n <= 203; n += 29) {
+        memset(out, 0, sizeof out);
+        sv_hash_batch(keys, n, out);
+        bool ok = true;
+        for (size_t i = 0; i < n; ++i) ok = ok && out[i] == sv_hash(keys[i]);
+        MT_CHECK_THAT(ok);
+        MT_CHECK_THAT(n == 203 || out[n] == 0);
+    }
+    sv_hash_batch(keys, 203, out);
+    bool ok = true;
+    for (size_t i = 0; i < 203; ++i) ok = ok && out[i] == sv_hash(keys[i]);
+    MT_CHECK_THAT(ok);
+    MT_CHECK_THAT(out[17] == sv_hash(sv_empty()));
+}
+
+// Bitwise CRC32C, to check the table and crc32 instruction paths against
+static uint32_t
+crc32c_bitwise(const char *p, size_t n, uint32_t seed)
+{
+    uint32_t crc = ~seed;
+    for (size_t i = 0; i < n; ++i) {
+        crc ^= (unsigned char)p[i];
+        for (int k = 0; k < 8; ++k) crc = (crc >> 1) ^ (0x82f63b78u & (0u - (crc & 1u)));
+    }
+    return ~crc;
+}
+
+MT_DEFINE_TEST(crc32c)
+{
+    // Check value, and RFC 3720 (iSCSI) test patterns
+    char buf[32];
+    MT_CHECK_THAT(sv_crc32c(SV_LIT("123456789"), 0) == 0xe3069283u);
+    MT_CHECK_THAT(sv_crc32c(sv_empty(), 0) == 0);
+    memset(buf, 0, sizeof buf);
+    MT_CHECK_THAT(sv_crc32c(sv_from_parts(buf, 32), 0) == 0x8a9136aau);
+    memset(buf, 0xFF, sizeof buf);
+    MT_CHECK_THAT(sv_crc32c(sv_from_parts(buf, 32), 0) == 0x62a8ab43u);
+    for (size_t i = 0; i < sizeof buf; ++i) buf[i] = (char)i;
+    MT_CHECK_THAT(sv_crc32c(sv_from_parts(buf, 32), 0) == 0x46dd794eu);
+
+    // Lengths on both sides of the interleaved block sizes, unaligned starts
+    static char data[80000];
+    uint32_t    state = 4242u;
+    for (size_t i = 0; i < sizeof data; ++i) {
+        state   = state * 1103515245u + 12345u;
+        data[i] = (char)(state >> 16);
+    }
+    bool ok = true;
+    for (size_t n = 0; n + 3 <= sizeof data; n = n < 64 ? n + 1 : n * 9 / 8) {
+        ok = ok && sv_crc32c(sv_from_parts(data + 3, n), 0) == crc32c_bitwise(data + 3, n, 0);
+    }
+    for (size_t n = 3 * 256 - 9; n <= 3 * 256 + 9; ++n) {
+        ok = ok && sv_crc32c(sv_from_parts(data + 1, n), 5) == crc32c_bitwise(data + 1, n, 5);
+    }
+    for (size_t n = 3 * 8192 - 9; n <= 3 * 8192 + 9; ++n) {
+        ok = ok && sv_crc32c(sv_from_parts(data, n), 5) == crc32c_bitwise(data, n, 5);
+    }
+    MT_CHECK_THAT(ok);
+
+    // A previous result as seed continues the checksum
+    const uint32_t whole = sv_crc32c(sv_from_parts(data, sizeof data), 0);
+    const uint32_t first = sv_crc32c(sv_from_parts(data, 30000), 0);
+    MT_CHECK_THAT(sv_crc32c(sv_from_parts(data + 30000, sizeof data - 30000), first) == whole);
+}
+
+MT_DEFINE_TEST(map_basic)
+{
+    SvMap map;
+    MT_ASSERT_THAT(sv_map_init(&map, 0, 1234, NULL));
+    MT_CHECK_THAT(map.capacity == 0 && sv_map_find(&map, SV_LIT("x")) == NULL);
+
+    int a = 1, b = 2, c = 3;
+    MT_ASSERT_THAT(sv_map_insert(&map, SV_LIT("content-type"), &a));
+    MT_ASSERT_THAT(sv_map_insert(&map, SV_LIT("content-length"), &b));
+    MT_ASSERT_THAT(sv_map_insert(&map, sv_empty(), &c));
+    MT_CHECK_THAT(map.count == 3);
+
+    // Lookup by any view with the same bytes
+    const char header[] = "Content-Length: content-length";
+    void **v = sv_map_find(&map, sv_from_parts(header + 16, 14));
+    MT_ASSERT_THAT(v != NULL);
+    MT_CHECK_THAT(*v == &b);
+    MT_CHECK_THAT(!sv_map_contains(&map, sv_from_parts(header, 14)));
+    MT_CHECK_THAT(sv_map_contains(&map, SV_LIT("")));
+
+    // Overwrite keeps the count, remove and reinsert
+    MT_ASSERT_THAT(sv_map_insert(&map, SV_LIT("content-type"), &c));
+    MT_CHECK_THAT(map.count == 3 && *sv_map_find(&map, SV_LIT("content-type")) == &c);
+    MT_CHECK_THAT(sv_map_remove(&map, SV_LIT("content-type")));
+    MT_CHECK_THAT(!sv_map_remove(&map, SV_LIT("content-type")));
+    MT_CHECK_THAT(map.count == 2 && !sv_map_contains(&map, SV_LIT("content-type")));
+
+    size_t     cursor = 0, seen = 0;
+    StringView key;
+    void      *value;
+    while (sv_map_next(&map, &cursor, &key, &value)) {
+        seen += 1;
+        MT_CHECK_THAT((sv_eq(key, SV_LIT("content-length")) && value == &b) || (key.length == 0 && value == &c));
+    }
+    MT_CHECK_THAT(seen == 2);
+
+    sv_map_clear(&map);
+    MT_CHECK_THAT(map.count == 0 && !sv_map_contains(&map, SV_LIT("content-length")));
+    sv_map_free(&map);
+    MT_CHECK_THAT(map.capacity == 0);
+}
+
+MT_DEFINE_TEST(map_matches_naive)
+{
+    // Random inserts and removes over a small key space, so tombstones pile up
+    // and get recycled, checked against a flat array of present/absent values.
+    enum { KEYS = 600 };
+    static char keys[KEYS][8];
+    static int  values[KEYS];
+    static bool present[KEYS];
+    for (int i = 0; i < KEYS; ++i) {
+        snprintf(keys[i], sizeof keys[i], "m%d", i * 7919 % 10007);
+        present[i] = false;
+    }
+
+    SvMap map;
+    MT_ASSERT_THAT(sv_map_init(&map, 0, 0, NULL));
+
+    bool     ok    = true;
+    size_t   count = 0;
+    uint32_t state = 2463534242u;
+    for (int iter = 0; iter < 200000 && ok; ++iter) {
+        state ^= state << 13; state ^= state >> 17; state ^= state << 5;
+        const int        k   = (int)(state % (iter < 100000 ? KEYS : KEYS / 3));
+        const StringView key = sv_from_cstr(keys[k]);
+        switch ((state >> 16) % 3) {
+        case 0:
+            ok = sv_map_insert(&map, key, &values[k]);
+            count += !present[k];
+            present[k] = true;
+            break;
+        case 1:
+            ok = sv_map_remove(&map, key) == present[k];
+            count -= present[k];
+            present[k] = false;
+            break;
+        default: {
+            void **v = sv_map_find(&map, key);
+            ok = present[k] ? v && *v == &values[k] : v == NULL;
+        }
+        }
+        ok = ok && map.count == count;
+    }
+    MT_CHECK_THAT(ok);
+
+    size_t cursor = 0, seen = 0;
+    void  *value;
+    while (sv_map_next(&map, &cursor, NULL, &value)) {
+        ok = ok && present[(int *)value - values];
+        seen += 1;
+    }
+    MT_CHECK_THAT(ok && seen == count);
+
+    // Reserving up front means no rehash while filling
+    sv_map_free(&map);
+    MT_ASSERT_THAT(sv_map_init(&map, KEYS, 0, NULL));
+    const size_t capacity = map.capacity;
+    for (int i = 0; i < KEYS; ++i) ok = ok && sv_map_insert(&map, sv_from_cstr(keys[i]), &values[i]);
+    MT_CHECK_THAT(ok && map.capacity == capacity && map.count == KEYS);
+    sv_map_free(&map);
+}
+
+MT_DEFINE_TEST(map_allocator)
+{
+    CountingAllocator counter   = { 0, 0 };
+    SvAllocator       allocator = counting_allocator(&counter);
+
+    char buf[100][4];
+    SvMap map;
+    MT_ASSERT_THAT(sv_map_init(&map, 0, 7, &allocator));
+    MT_CHECK_THAT(counter.allocations == 0);
+    bool ok = true;
+    for (size_t i = 0; i < 100; ++i) {
+        buf[i][0] = 'k';
+        buf[i][1] = (char)('0' + i / 10);
+        buf[i][2] = (char)('0' + i % 10);
+        ok = ok && sv_map_insert(&map, sv_from_parts(buf[i], 3), NULL);
+    }
+    MT_CHECK_THAT(ok && map.count == 100);
+    MT_CHECK_THAT(counter.allocations > 1 && counter.live_bytes > 0);
+
+    sv_map_free(&map);
+    MT_CHECK_THAT(counter.live_bytes == 0);
+}
+
+MT_DEFINE_TEST(intern_basic)
+{
+    SvInternPool pool;
+    MT_ASSERT_THAT(sv_intern_pool_init(&pool, 0, 0, 0x9e3779b97f4a7c15ULL, NULL));
+
+    char line[] = "GET example.com GET example.org GET";
+    uint32_t   id[5];
+    StringView view[5];
+    MT_ASSERT_THAT(sv_intern(&pool, sv_from_parts(line, 3), &id[0], &view[0]));
+    MT_ASSERT_THAT(sv_intern(&pool, sv_from_parts(line + 4, 11), &id[1], &view[1]));
+    MT_ASSERT_THAT(sv_intern(&pool, sv_from_parts(line + 16, 3), &id[2], &view[2]));
+    MT_ASSERT_THAT(sv_intern(&pool, sv_from_parts(line + 20, 11), &id[3], &view[3]));
+    MT_ASSERT_THAT(sv_intern(&pool, sv_from_parts(line + 32, 3), &id[4], &view[4]));
+
+    // Dense IDs in first-seen order, one canonical copy per string
+    MT_CHECK_THAT(pool.count == 3);
+    MT_CHECK_THAT(id[0] == 0 && id[1] == 1 && id[2] == 0 && id[3] == 2 && id[4] == 0);
+    MT_CHECK_THAT(view[0].begin == view[2].begin && view[0].begin == view[4].begin);
+    MT_CHECK_THAT(view[0].begin != line && view[1].begin != view[3].begin);
+    MT_CHECK_THAT(sv_eq(view[3], SV_LIT("example.org")) && view[3].begin[11] == '\0');
+
+    // The copies do not depend on the input
+    memset(line, 'x', sizeof line - 1);
+    MT_CHECK_THAT(sv_eq(sv_intern_view(&pool, 1), SV_LIT("example.com")));
+
+    uint32_t found = 99;
+    MT_CHECK_THAT(sv_intern_find(&pool, SV_LIT("GET"), &found) && found == 0);
+    MT_CHECK_THAT(!sv_intern_find(&pool, SV_LIT("POST"), &found) && found == 0);
+    MT_CHECK_THAT(pool.count == 3);
+
+    // The empty string is a string like any other, with its own pointer
+    MT_ASSERT_THAT(sv_intern(&pool, sv_empty(), &found, &view[0]));
+    MT_CHECK_THAT(found == 3 && view[0].length == 0 && view[0].begin != NULL);
+    MT_CHECK_THAT(sv_intern(&pool, SV_LIT(""), &found, NULL) && found == 3);
+
+    // Many strings, some longer than a block, keep their IDs and views
+    char buf[32];
+    bool ok = true;
+    for (int i = 0; i < 20000 && ok; ++i) {
+        const int n = snprintf(buf, sizeof buf, "host-%d.example", i % 5000);
+        ok = sv_intern(&pool, sv_from_parts(buf, (size_t)n), &found, NULL) && found == 4 + (uint32_t)(i % 5000);
+    }
+    static char big[SV_INTERN_BLOCK_SIZE * 2];
+    memset(big, 'b', sizeof big);
+    ok = ok && sv_intern(&pool, sv_from_parts(big, sizeof big), &found, &view[0]) && found == 5004;
+    ok = ok && sv_eq(sv_intern_view(&pool, 4), SV_LIT("host-0.example")) && view[0].length == sizeof big;
+    MT_CHECK_THAT(ok && pool.count == 5005);
+
+    sv_intern_pool_free(&pool);
+    MT_CHECK_THAT(pool.count == 0);
+}
+
+MT_DEFINE_TEST(intern_presized)
+{
+    CountingAllocator counter   = { 0, 0 };
+    SvAllocator       allocator = counting_allocator(&counter);
+
+    SvInternPool pool;
+    MT_ASSERT_THAT(sv_intern_pool_init(&pool, 1000, 1000 * 8, 42, &allocator));
+    const size_t allocations = counter.allocations;
+
+    char buf[16];
+    bool ok = true;
+    for (int i = 0; i < 1000 && ok; ++i) {
+        const int n = snprintf(buf, sizeof buf, "k%07d", i);
+        uint32_t  id;
+        ok = sv_intern(&pool, sv_from_parts(buf, (size_t)n), &id, NULL) && id == (uint32_t)i;
+    }
+    MT_CHECK_THAT(ok && pool.count == 1000);
+    MT_CHECK_THAT(counter.allocations == allocations);
+
+    sv_intern_pool_free(&pool);
+    MT_CHECK_THAT(counter.live_bytes == 0);
+}
+
+MT_DEFINE_TEST(phf_basic)
+{
+    const StringView keys[] = { SV_LIT("cpu.user"), SV_LIT("cpu.system"), SV_LIT("mem.rss"), SV_LIT(""), SV_LIT("disk.io") };
+    SvPhf phf;
+    MT_ASSERT_THAT(sv_phf_init(&phf, keys, 5, NULL));
+
+    bool ok = true;
+    for (size_t i = 0; i < 5; ++i) ok = ok && sv_phf_lookup(&phf, keys[i]) == i;
+    MT_CHECK_THAT(ok);
+
+    const char line[] = "mem.rss.peak";
+    MT_CHECK_THAT(sv_phf_lookup(&phf, sv_from_parts(line, 7)) == 2);
+    MT_CHECK_THAT(sv_phf_lookup(&phf, sv_from_cstr(line)) == SV_NPOS);
+    MT_CHECK_THAT(sv_phf_lookup(&phf, SV_LIT("cpu")) == SV_NPOS);
+    sv_phf_free(&phf);
+
+    // Empty set, and duplicates cannot be hashed perfectly
+    MT_ASSERT_THAT(sv_phf_init(&phf, NULL, 0, NULL));
+    MT_CHECK_THAT(sv_phf_lookup(&phf, SV_LIT("x")) == SV_NPOS);
+    sv_phf_free(&phf);
+    const StringView dup[] = { SV_LIT("a"), SV_LIT("b"), SV_LIT("a") };
+    MT_CHECK_THAT(!sv_phf_init(&phf, dup, 3, NULL));
+    sv_phf_free(&phf);
+}
+
+MT_DEFINE_TEST(phf_large)
+{
+    CountingAllocator counter   = { 0, 0 };
+    SvAllocator       allocator = counting_allocator(&counter);
+
+    enum { N = 5000 };
+    static char       buf[N][24];
+    static StringView keys[N];
+    for (size_t i = 0; i < N; ++i) {
+        const int n = snprintf(buf[i], sizeof buf[i], "service.%zu.latency", i * 31);
+        keys[i] = sv_from_parts(buf[i], (size_t)n);
+    }
+
+    SvPhf phf;
+    MT_ASSERT_THAT(sv_phf_init(&phf, keys, N, &allocator));
+    MT_CHECK_THAT(counter.allocations == 2); // table and build scratch space
+    MT_CHECK_THAT(counter.live_bytes == phf.memory_size);
+
+    bool ok = true;
+    char other[32];
+    for (size_t i = 0; i < N && ok; ++i) {
+        ok = sv_phf_lookup(&phf, keys[i]) == i;
+        const int n = snprintf(other, sizeof other, "service.%zu.latency", i * 31 + 1);
+        ok = ok && sv_phf_lookup(&phf, sv_from_parts(other, (size_t)n)) == SV_NPOS;
+    }
+    MT_CHECK_THAT(ok);
+
+    sv_phf_free(&phf);
+    MT_CHECK_THAT(counter.live_bytes == 0);
+}
+
+#ifdef SV_CONSTEXPR_CPP
+static_assert(sv_eq_ct(SV_LIT("GET"), SV_LIT("GET")) && !sv_eq_ct(SV_LIT("GET"), SV_LIT("GE")), "");
+static_assert(sv_starts_with_ct(SV_LIT("content-type"), SV_LIT("content-")), "");
+static_assert(sv_ends_with_ct(SV_LIT("content-type"), SV_LIT("-type")), "");
+static_assert(sv_hash_fnv1a_ct(SV_LIT("foobar")) == 0x88fad7c0a8ff07f2ULL, "");
+static_assert(sv_hash64_seeded_ct(SV_LIT("message digest"), 3) == 0x786d1f1df3801df4ULL, "");
+static_assert(sv_hash64_seeded_ct(SV_LIT("12345678901234567890123456789012345678901234567890123456789012345678901234567890"), 6) ==
+              0x6cc5eab49a92d617ULL, "");
+
+MT_DEFINE_TEST(constexpr_hash_matches_runtime)
+{
+    char buf[100];
+    for (size_t i = 0; i < sizeof buf; ++i) buf[i] = (char)(i * 37 + 11);
+
+    bool ok = true;
+    for (size_t n = 0; n <= sizeof buf; ++n) {
+        const StringView sv = sv_from_parts(buf, n);
+        ok = ok && sv_hash64_seeded_ct(sv, n) == sv_hash64_seeded(sv, n);
+        ok = ok && sv_hash_fnv1a_ct(sv) == sv_hash_fnv1a(sv) && sv_hash_ct(sv) == sv_hash(sv);
+    }
+    MT_CHECK_THAT(ok);
+}
+
+MT_DEFINE_TEST(keywords_switch)
+{
+    static constexpr auto methods = sv_keywords("GET", "HEAD", "POST", "PUT", "DELETE", "CONNECT", "OPTIONS", "TRACE", "PATCH");
+    MT_CHECK_THAT(sv_keywords_find(methods, SV_LIT("GET")) == 0);
+    MT_CHECK_THAT(sv_keywords_find(methods, SV_LIT("PATCH")) == 8);
+    MT_CHECK_THAT(sv_keywords_find(methods, SV_LIT("get")) == SV_NPOS);
+    MT_CHECK_THAT(sv_keywords_find(methods, SV_LIT("GETS")) == SV_NPOS);
+    MT_CHECK_THAT(sv_keywords_find(methods, sv_empty()) == SV_NPOS);
+
+    const char request[] = "POST /index.html HTTP/1.1";
+    const StringView method = sv_from_parts(request, 4);
+    int route = -1;
+    switch (sv_switch(method, "GET", "POST", "")) {
+    case 0:      route = 0; break;
+    case 1:      route = 1; break;
+    case 2:      route = 2; break;
+    case SV_NPOS: route = 3; break;
+    }
+    MT_CHECK_THAT(route == 1);
+    MT_CHECK_THAT(sv_switch(sv_empty(), "GET", "POST", "") == 2);
+    MT_CHECK_THAT(sv_switch(SV_LIT("x"), "only") == SV_NPOS);
+    MT_CHECK_THAT(sv_switch(SV_LIT("only"), "only") == 0);
+
+    // Every keyword of a larger set maps to its own index
+    static constexpr auto keys = sv_keywords("id", "name", "email", "created_at", "updated_at", "deleted_at",
+                                             "status", "type", "owner", "group", "tags", "labels", "version",
+                                             "checksum", "size", "path", "mime", "url", "parent", "children");
+    bool ok = true;
+    for (size_t i = 0; i < 20; ++i) ok = ok && sv_keywords_find(keys, keys.words[i]) == i;
+    MT_CHECK_THAT(ok);
+}
+#endif
+
 #if defined(__cplusplus) && __cplusplus >= 201703L  && defined(SV_STD_SV_CONV)
 #define TEST_STD_SV
 MT_DEFINE_TEST(sv_from_std_sv)
@@ -1766,6 +3570,16 @@ main(void)
     MT_RUN_TEST(rfind_substr);
     MT_RUN_TEST(find_substr_from);
     MT_RUN_TEST(rfind_substr_from);
+    MT_RUN_TEST(find_substr_long_haystack);
+    MT_RUN_TEST(rfind_long_haystack);
+    MT_RUN_TEST(searcher_basic);
+    MT_RUN_TEST(searcher_matches_find_substr);
+    MT_RUN_TEST(multi_searcher_basic);
+    MT_RUN_TEST(multi_searcher_matches_naive);
+    MT_RUN_TEST(multi_searcher_allocator);
+    MT_RUN_TEST(byteset_basic);
+    MT_RUN_TEST(byteset_all_byte_values);
+    MT_RUN_TEST(find_char2_char3);
     MT_RUN_TEST(find_substr_cstr);
 
     MT_RUN_TEST(contains);
@@ -1774,6 +3588,8 @@ main(void)
     MT_RUN_TEST(trim_left);
     MT_RUN_TEST(trim_right);
     MT_RUN_TEST(trim);
+    MT_RUN_TEST(trim_ascii);
+    MT_RUN_TEST(trim_set);
 
     MT_RUN_TEST(take_basic);
     MT_RUN_TEST(take_zero_and_empty);
@@ -1815,6 +3631,15 @@ main(void)
     MT_RUN_TEST(split_first);
     MT_RUN_TEST(split_last);
     MT_RUN_TEST(split_once_from);
+    MT_RUN_TEST(split_first_of);
+    MT_RUN_TEST(split_iter_char);
+    MT_RUN_TEST(split_iter_str_and_set);
+    MT_RUN_TEST(split_into);
+    MT_RUN_TEST(split_into_matches_iter);
+    MT_RUN_TEST(line_iter);
+    MT_RUN_TEST(line_iter_batch_matches_next);
+    MT_RUN_TEST(csv_basic);
+    MT_RUN_TEST(csv_options_and_errors);
 
     MT_RUN_TEST(to_cstr);
 
@@ -1824,15 +3649,42 @@ main(void)
     MT_RUN_TEST(to_int64_limits);
     MT_RUN_TEST(to_uint64_format_errors);
     MT_RUN_TEST(to_int64_format_errors);
+    MT_RUN_TEST(to_int_matches_reference);
     MT_RUN_TEST(to_long_basic);
     MT_RUN_TEST(to_long_limits);
     MT_RUN_TEST(to_long_format_errors);
+    MT_RUN_TEST(to_int_base);
+    MT_RUN_TEST(hex_decode);
     MT_RUN_TEST(to_double_basic);
     MT_RUN_TEST(to_double_exponent);
     MT_RUN_TEST(to_double_limits);
     MT_RUN_TEST(to_double_format_errors);
     MT_RUN_TEST(to_double_precision_paths);
     MT_RUN_TEST(to_double_signed_zero);
+    MT_RUN_TEST(to_double_correctly_rounded);
+    MT_RUN_TEST(fmt_int);
+    MT_RUN_TEST(fmt_double);
+    MT_RUN_TEST(parse_prefix);
+    MT_RUN_TEST(parse_and_consume);
+    MT_RUN_TEST(parse_batch);
+    MT_RUN_TEST(parse_fields);
+
+    MT_RUN_TEST(hash);
+    MT_RUN_TEST(hasher_matches_oneshot);
+    MT_RUN_TEST(hash_batch);
+    MT_RUN_TEST(crc32c);
+    MT_RUN_TEST(map_basic);
+    MT_RUN_TEST(map_matches_naive);
+    MT_RUN_TEST(map_allocator);
+    MT_RUN_TEST(intern_basic);
+    MT_RUN_TEST(intern_presized);
+    MT_RUN_TEST(phf_basic);
+    MT_RUN_TEST(phf_large);
+
+#ifdef SV_CONSTEXPR_CPP
+    MT_RUN_TEST(constexpr_hash_matches_runtime);
+    MT_RUN_TEST(keywords_switch);
+#endif
 
 #ifdef TEST_STD_SV
     MT_RUN_TEST(sv_from_std_sv);